@@ -1,34 +1,85 @@
+#include <map>
 #include <set>
 #include <cmath>
+#include <array>
+#include <cfloat>
+#include <memory>
 #include <ctime>
+#include <cstddef>
 #include <chrono>
 #include <cstdio>
 #include <cstdlib>
+#include <cerrno>
+#include <cctype>
 #include <fstream>
+#include <sstream>
+#include <filesystem>
 #include <stdlib.h>
 #include <stdint.h>
 #include <string.h>
 #include <optional>
+#include <deque>
+#include <thread>
+#include <atomic>
+#include <mutex>
+#include <future>
 #include <iostream>
 #include <algorithm>
+#include <numeric>
+#include <limits>
+#include <bitset>
 
 #include <vulkan/vulkan.hpp>
 
+#ifdef POLAR_USE_SHADERC
+#include <shaderc/shaderc.hpp>
+#endif
+
 #ifdef _WIN32
 
+#include <io.h>
 #include <wrl.h>
+#include <psapi.h>
 #include <wincodec.h>
 
 #define THROW_FATAL_ERROR(msg) MessageBoxA(NULL, msg, "Error", MB_ICONERROR)
 
 #else
 
+#include <zlib.h>
+
+#include <fcntl.h>
+#include <signal.h>
+#include <unistd.h>
+#include <sys/un.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/socket.h>
+#include <sys/resource.h>
+
 #define THROW_FATAL_ERROR(msg) std::cerr << msg << '\n'
 
 #endif
 
+// SSE2 Is Part Of x86-64, AVX2 Is Detected At Runtime
+#if defined(__x86_64__) || defined(_M_X64)
+
+#define POLAR_X86
+
+#include <immintrin.h>
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#define POLAR_TARGET_AVX2
+#else
+#define POLAR_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+
+#endif
+
 // Meant to be modified
-#define GPU_WORKGROUP_SIZE (32u) // NVIDIA: 32, AMD: 64
+#define GPU_WORKGROUP_SIZE (32u) // NVIDIA: 32, AMD: 64 (Lowered At Runtime If The Device Can't Fit It)
+#define WAVEFRONT_WORKGROUP_SIZE (64u) // Threads Per Workgroup Of The 1D Wavefront Kernels (Within Vulkan's Guaranteed Limits)
 
 struct Coloru8 {
     std::uint8_t r, g, b, a;
@@ -38,509 +89,7513 @@ struct Colorf32 {
     float r, g, b, a;
 }; // Colorf32
 
-// Constants
-class Image {
-private:
-    const std::uint16_t m_width;
-    const std::uint16_t m_height;
-    const std::uint32_t m_nPixels;
+// Mirrors The Shader's PassConstants Push Constant Block (std430)
+struct PassConstants {
+    std::uint32_t tileOffsetX, tileOffsetY;
+    std::uint32_t tileExtentX, tileExtentY;
+    std::uint32_t sampleOffset;
+    std::uint32_t sampleCount;
+    std::uint32_t frameIndex;
+    std::uint32_t bounceIndex; // Only Read By The Wavefront Kernels
+    std::uint32_t pixelList;   // The Tile's PixelListHeader In Adaptive Passes, NO_PIXEL_LIST Otherwise
+    std::uint32_t pixelListOffset;
+    std::uint32_t padding[2];
+    float         cameraPosition[4];
+    float         cameraTarget[4];
+}; // PassConstants
+
+static_assert(offsetof(PassConstants, cameraPosition) == 48u, "vec4 Members Are 16-Byte Aligned In The Shader");
+
+constexpr std::uint32_t NO_PIXEL_LIST = UINT32_MAX; // common.glsl's NO_PIXEL_LIST
+
+// Mirrors The Shader's Specialization Constants (constant_id Follows Declaration Order)
+struct SpecializationConstants {
+    std::uint32_t workgroupSize;
+    std::uint32_t width;
+    std::uint32_t height;
+    std::uint32_t maxIterations;
+    std::uint32_t profile;       // VkBool32, Enables Ray Counting
+    std::uint32_t wavefrontWorkgroupSize;
+    std::uint32_t sampleSequence; // SampleSequence, See common.glsl's SAMPLE_SEQUENCE_*
+    std::uint32_t adaptive;       // VkBool32
+    float         adaptiveThreshold;
+    std::uint32_t adaptiveMinSamples;
+    std::uint32_t aov;            // VkBool32
+    std::uint32_t outOfCore;      // VkBool32, The Buffers Hold One Tile
+    std::uint32_t accumulationHalf; // VkBool32, AccumulationFormat::eRGBA16F
+    std::uint32_t resolve;          // GpuResolve, See common.glsl's RESOLVE_*
+    std::uint32_t toneMapping;      // ToneMapping, Only Read By resolve.glsl
+}; // SpecializationConstants
+
+// Mirrors The Shader's RayStats Buffer, A 64-bit Counter Split In Two Words
+struct RayStats {
+    std::uint32_t rayCountLo;
+    std::uint32_t rayCountHi;
+}; // RayStats
+
+// Mirror wavefront.glsl's PathState, Hit & Queue (std430), Only Their Sizes Matter To The Host
+struct WavefrontPath {
+    float         origin[3];
+    std::uint32_t sampleSlot;
+    float         direction[3];
+    std::uint32_t rngState;
+    float         throughput[3];
+    float         bsdfPdf;
+    float         radiance[3];
+    std::uint32_t bActive;
+    std::uint32_t samplerSeed;
+    std::uint32_t samplerIndex;
+    std::uint32_t padding[2]; // std430 Rounds The Struct Up To Its 16-Byte Alignment
+}; // WavefrontPath
+
+struct WavefrontHit {
+    float         normal[3];
+    float         t;
+    std::uint32_t materialIndex;
+    std::uint32_t lightIndex;
+    std::uint32_t padding[2];
+}; // WavefrontHit
+
+// Starts With A VkDispatchIndirectCommand, So The Queue's Header Sizes The Next Stage's Dispatch
+struct WavefrontQueue {
+    std::uint32_t groupCountX, groupCountY, groupCountZ;
+    std::uint32_t count;
+}; // WavefrontQueue
+
+// Mirrors common.glsl's PixelListHeader: Indirect Dispatches Over A Tile's Unconverged Pixels & Over Their Paths
+struct PixelListHeader {
+    std::uint32_t groupCountX, groupCountY, groupCountZ;
+    std::uint32_t count;
+    std::uint32_t pathGroupCountX, pathGroupCountY, pathGroupCountZ;
+    std::uint32_t pathCount;
+}; // PixelListHeader
+
+static_assert(sizeof(PixelListHeader) == 2u * sizeof(WavefrontQueue) && offsetof(PixelListHeader, pathGroupCountX) == sizeof(WavefrontQueue),
+    "The Path Half Of A Header Is Copied Into The First Wavefront Queue");
+
+static_assert(sizeof(WavefrontPath) == 80u && sizeof(WavefrontHit) == 32u && sizeof(WavefrontQueue) == 16u, "Must Match The std430 Layouts In wavefront.glsl");
+
+// The Kernels Of The Wavefront Mode, In Dispatch Order
+enum WavefrontStage : std::uint32_t {
+    eWavefrontStageGenerate = 0u,
+    eWavefrontStageExtend,
+    eWavefrontStageShade,
+    eWavefrontStageCompact,
+    eWavefrontStageAccumulate,
+    WAVEFRONT_STAGE_COUNT
+}; // WavefrontStage
+
+constexpr std::array<const char*, WAVEFRONT_STAGE_COUNT> WAVEFRONT_SHADER_FILES = {
+    "wavefront_generate.glsl", "wavefront_extend.glsl", "wavefront_shade.glsl", "wavefront_compact.glsl", "wavefront_accumulate.glsl"
+};
 
-    std::unique_ptr<Coloru8[]> m_pBuff;
+// Splits [0, count) Into Contiguous Ranges Processed By All Hardware Threads
+template <typename Function>
+void ParallelFor(const size_t count, const size_t minimumRangeSize, const Function& function) {
+    const size_t threadCount = std::max<size_t>(1u, std::min<size_t>(std::thread::hardware_concurrency(), (count + minimumRangeSize - 1u) / std::max<size_t>(1u, minimumRangeSize)));
+    const size_t rangeSize   = (count + threadCount - 1u) / threadCount;
 
-public:
-    Image() = default;
+    std::vector<std::thread> threads;
+    threads.reserve(threadCount - 1u);
 
-    Image(const std::uint16_t width, const std::uint16_t height) noexcept
-        : m_width(width), m_height(height),
-        m_nPixels(static_cast<std::uint32_t>(width)* height)
-    {
-        this->m_pBuff = std::make_unique<Coloru8[]>(this->m_nPixels);
+    for (size_t t = 1u; t < threadCount; t++)
+        threads.emplace_back([&function, t, rangeSize, count]() { function(std::min(count, t * rangeSize), std::min(count, (t + 1u) * rangeSize)); });
+
+    function(0u, std::min(count, rangeSize));
+
+    for (std::thread& thread : threads)
+        thread.join();
+}
+
+// Runs function(task) For Every Task In [0, count) On All Hardware Threads
+// Each Thread Starts With A Contiguous Share Of The Tasks And Steals From The Tails Of The Others' Once It Runs Out,
+// Which Keeps Every Core Busy When Tasks Have Uneven Costs
+template <typename Function>
+void ParallelForWorkStealing(const size_t count, const Function& function) {
+    struct TaskQueue {
+        std::mutex mutex;
+        size_t     begin = 0u, end = 0u;
+    }; // TaskQueue
+
+    const size_t threadCount = std::max<size_t>(1u, std::min<size_t>(std::thread::hardware_concurrency(), count));
+
+    std::vector<TaskQueue> queues(threadCount);
+    for (size_t t = 0u; t < threadCount; t++) {
+        queues[t].begin = count * t / threadCount;
+        queues[t].end   = count * (t + 1u) / threadCount;
     }
 
-    inline std::uint16_t GetWidth()      const noexcept { return this->m_width; }
-    inline std::uint16_t GetHeight()     const noexcept { return this->m_height; }
-    inline std::uint32_t GetPixelCount() const noexcept { return this->m_nPixels; }
+    auto Worker = [&queues, &function, threadCount](const size_t self) {
+        for (;;) {
+            size_t task = SIZE_MAX;
 
-    inline Coloru8* GetBufferPtr() const noexcept { return this->m_pBuff.get(); }
+            { // Own Queue First, From The Front
+                std::lock_guard<std::mutex> lock(queues[self].mutex);
+                if (queues[self].begin < queues[self].end)
+                    task = queues[self].begin++;
+            }
 
-    inline       Coloru8& operator()(const size_t i)       noexcept { return this->m_pBuff[i]; }
-    inline const Coloru8& operator()(const size_t i) const noexcept { return this->m_pBuff[i]; }
+            // Then Steal From The Back Of The Others
+            for (size_t i = 1u; i < threadCount && task == SIZE_MAX; i++) {
+                TaskQueue& victim = queues[(self + i) % threadCount];
 
-    inline       Coloru8& operator()(const size_t x, const size_t y)       noexcept { return this->m_pBuff[y * this->m_width + this->m_height]; }
-    inline const Coloru8& operator()(const size_t x, const size_t y) const noexcept { return this->m_pBuff[y * this->m_width + this->m_height]; }
+                std::lock_guard<std::mutex> lock(victim.mutex);
+                if (victim.begin < victim.end)
+                    task = --victim.end;
+            }
+
+            if (task == SIZE_MAX)
+                return;
+
+            function(task);
+        }
+    };
+
+    std::vector<std::thread> threads;
+    threads.reserve(threadCount - 1u);
+
+    for (size_t t = 1u; t < threadCount; t++)
+        threads.emplace_back(Worker, t);
+
+    Worker(0u);
+
+    for (std::thread& thread : threads)
+        thread.join();
+}
+
+enum class ToneMapping {
+    eLinear, // Clamp Only
+    eGamma,  // x^(1/2.2)
+    eSRGB    // The Piecewise sRGB Transfer Function
+}; // ToneMapping
+
+// --tonemap's Values, Anything Else Is Linear
+inline ToneMapping ParseToneMapping(const std::string& name) noexcept {
+    return (name == "srgb") ? ToneMapping::eSRGB : (name == "gamma") ? ToneMapping::eGamma : ToneMapping::eLinear;
+}
+
+// How The GPU Stores A Frame's Running Accumulation (--accumulation), Mirrors common.glsl's ACCUMULATION_HALF
+enum class AccumulationFormat {
+    eRGBA32F, // The RGB Sums & The Sample Count As Floats, 16 Bytes Per Pixel
+    eRGBA16F  // The RGB Mean As Halves & A 16-Bit Sample Count, 8 Bytes Per Pixel
+}; // AccumulationFormat
+
+constexpr std::uint32_t MAX_HALF_ACCUMULATION_SAMPLES = 65535u; // The Largest Sample Count eRGBA16F Can Hold
+// Every Pass Rounds eRGBA16F's Mean To A Half Again (Up To 2^-11 Of It, Toward Zero On Some Devices), Which Adds Up Over The Passes
+// & Stops Small Updates From Landing At All. Past This Many Passes The Error Could Reach ~1.5%, So Longer Renders Use eRGBA32F
+constexpr std::uint32_t MAX_HALF_ACCUMULATION_PASSES  = 64u;
 
-    void Save(const std::string& filename) noexcept { // filename shouldn't contain the file extension
-#ifdef _WIN32 // Use WIC (Windows Imaging Component) To Save A .PNG File Natively
+// --accumulation's Values, Anything Else Is RGBA32F
+inline AccumulationFormat ParseAccumulationFormat(const std::string& name) noexcept {
+    return (name == "rgba16f") ? AccumulationFormat::eRGBA16F : AccumulationFormat::eRGBA32F;
+}
+
+// What The GPU Reads Back For The Host To Save (--resolve), Mirrors common.glsl's RESOLVE_*
+enum class GpuResolve {
+    eHost,  // The Accumulation, Which The Host Normalizes & Tone Maps
+    eRGBA8, // Tone Mapped & Quantized On The GPU, The Host Writes The Pixels As They Are
+    eRGB9E5 // The Mean Color As A Shared-Exponent Word, Which The Host Tone Maps
+}; // GpuResolve
 
-        const std::string  fullFilename = filename + ".png";
-        const std::wstring fullFilenameW(fullFilename.begin(), fullFilename.end());
+// --resolve's Values, Anything Else Is Host
+inline GpuResolve ParseGpuResolve(const std::string& name) noexcept {
+    return (name == "rgba8") ? GpuResolve::eRGBA8 : (name == "rgb9e5") ? GpuResolve::eRGB9E5 : GpuResolve::eHost;
+}
 
-        Microsoft::WRL::ComPtr<IWICImagingFactory>    factory;
-        Microsoft::WRL::ComPtr<IWICBitmapEncoder>     bitmapEncoder;
-        Microsoft::WRL::ComPtr<IWICBitmapFrameEncode> bitmapFrame;
-        Microsoft::WRL::ComPtr<IWICStream>            outputStream;
+// Maps [0, 1] Quantized To 12 Bits To The Tone Mapped 8-Bit Value
+// Stored As 32-Bit Integers So That It Can Be Used With Gathers
+class ToneMappingLUT {
+public:
+    static constexpr std::uint32_t SIZE = 4096u;
 
-        if (CoCreateInstance(CLSID_WICImagingFactory, NULL, CLSCTX_INPROC_SERVER, IID_PPV_ARGS(&factory)) != S_OK)
-            THROW_FATAL_ERROR("[WIC] Could Not Create IWICImagingFactory");
+private:
+    std::array<std::int32_t, SIZE> m_table;
 
-        if (factory->CreateStream(&outputStream) != S_OK)
-            THROW_FATAL_ERROR("[WIC] Failed To Create Output Stream");
+public:
+    explicit ToneMappingLUT(const ToneMapping toneMapping) noexcept {
+        for (std::uint32_t i = 0u; i < SIZE; i++) {
+            const float x = i / static_cast<float>(SIZE - 1u);
 
-        if (outputStream->InitializeFromFilename(fullFilenameW.c_str(), GENERIC_WRITE) != S_OK)
-            THROW_FATAL_ERROR("[WIC] Failed To Initialize Output Stream From Filename");
+            float y = x;
+            if (toneMapping == ToneMapping::eGamma)
+                y = std::pow(x, 1.f / 2.2f);
+            else if (toneMapping == ToneMapping::eSRGB)
+                y = (x <= 0.0031308f) ? (12.92f * x) : (1.055f * std::pow(x, 1.f / 2.4f) - 0.055f);
 
-        if (factory->CreateEncoder(GUID_ContainerFormatPng, NULL, &bitmapEncoder) != S_OK)
-            THROW_FATAL_ERROR("[WIC] Failed To Create Bitmap Encoder");
+            this->m_table[i] = static_cast<std::int32_t>(y * 255.f + 0.5f);
+        }
+    }
 
-        if (bitmapEncoder->Initialize(outputStream.Get(), WICBitmapEncoderNoCache) != S_OK)
-            THROW_FATAL_ERROR("[WIC] Failed To Initialize Bitmap ");
+    inline const std::int32_t* GetData() const noexcept { return this->m_table.data(); }
+}; // ToneMappingLUT
 
-        if (bitmapEncoder->CreateNewFrame(&bitmapFrame, NULL) != S_OK)
-            THROW_FATAL_ERROR("[WIC] Failed To Create A New Frame");
+namespace Resolve {
 
-        if (bitmapFrame->Initialize(NULL) != S_OK)
-            THROW_FATAL_ERROR("[WIC] Failed To Initialize A Bitmap's Frame");
+    // Each Function Converts 'count' Accumulated Pixels (RGB Sums + Sample Count In Alpha) To Opaque RGBA8
+    // 'pLUT' Is nullptr For Linear Output
 
-        if (bitmapFrame->SetSize(this->m_width, this->m_height) != S_OK)
-            THROW_FATAL_ERROR("[WIC] Failed To Set A Bitmap's Frame's Size");
+    void Scalar(const Colorf32* pSrc, Coloru8* pDst, const size_t count, const std::int32_t* pLUT) noexcept {
+        const float scale = pLUT ? static_cast<float>(ToneMappingLUT::SIZE - 1u) : 255.f;
 
-        const WICPixelFormatGUID desiredPixelFormat = GUID_WICPixelFormat32bppBGRA;
+        for (size_t i = 0u; i < count; i++) {
+            const float sampleCount = pSrc[i].a;
+            const float channels[3] = { pSrc[i].r, pSrc[i].g, pSrc[i].b };
 
-        WICPixelFormatGUID currentPixelFormat = {};
-        if (bitmapFrame->SetPixelFormat(&currentPixelFormat) != S_OK)
-            THROW_FATAL_ERROR("[WIC] Failed To Set Pixel Format On A Bitmap Frame's");
+            // Mirrors The SIMD Paths: Divide, Clamp (NaN To 0, As maxps Does), Round To Nearest Even
+            std::uint8_t quantized[3];
+            for (size_t c = 0u; c < 3u; c++) {
+                const float mean       = (sampleCount > 0.f) ? channels[c] / sampleCount : 0.f;
+                const float normalized = !(mean > 0.f) ? 0.f : std::min(mean, 1.f);
+                const auto  value      = static_cast<std::int32_t>(std::nearbyint(normalized * scale));
 
-        if (!IsEqualGUID(currentPixelFormat, desiredPixelFormat))
-            THROW_FATAL_ERROR("[WIC] The Requested Pixel Format Is Not Supported");
+                quantized[c] = static_cast<std::uint8_t>(pLUT ? pLUT[value] : value);
+            }
 
-        if (bitmapFrame->WritePixels(this->m_height, this->m_width * sizeof(Coloru8), this->m_nPixels * sizeof(Coloru8), (BYTE*)this->m_pBuff.get()) != S_OK)
-            THROW_FATAL_ERROR("[WIC] Failed To Write Pixels To A Bitmap's Frame");
+            pDst[i] = Coloru8{ quantized[0], quantized[1], quantized[2], 255u };
+        }
+    }
 
-        if (bitmapFrame->Commit() != S_OK)
-            THROW_FATAL_ERROR("[WIC] Failed To Commit A Bitmap's Frame");
+#ifdef POLAR_X86
 
-        if (bitmapEncoder->Commit() != S_OK)
-            THROW_FATAL_ERROR("[WIC] Failed To Commit Bitmap Encoder");
+    void SSE2(const Colorf32* pSrc, Coloru8* pDst, const size_t count, const std::int32_t* pLUT) noexcept {
+        const __m128  zero      = _mm_setzero_ps();
+        const __m128  one       = _mm_set1_ps(1.f);
+        const __m128  scale     = _mm_set1_ps(pLUT ? static_cast<float>(ToneMappingLUT::SIZE - 1u) : 255.f);
+        const __m128i alphaMask = _mm_setr_epi32(0, 0, 0, -1);
+        const __m128i alpha     = _mm_setr_epi32(0, 0, 0, 255);
 
-#else // On Other Operating Systems, Simply Write A .PAM File
+        // One Pixel Per Register: Normalize By The Sample Count, Clamp & Scale
+        auto ResolvePixel = [&](const Colorf32& pixel) {
+            const __m128 value       = _mm_loadu_ps(&pixel.r);
+            const __m128 sampleCount = _mm_shuffle_ps(value, value, _MM_SHUFFLE(3, 3, 3, 3));
+            const __m128 normalized  = _mm_and_ps(_mm_div_ps(value, sampleCount), _mm_cmpgt_ps(sampleCount, zero));
 
-        const std::string fullFilename = filename + ".pam";
+            __m128i quantized = _mm_cvtps_epi32(_mm_mul_ps(_mm_min_ps(_mm_max_ps(normalized, zero), one), scale));
 
-        // Open
-        FILE* fp = std::fopen(fullFilename.c_str(), "wb");
+            if (pLUT) {
+                alignas(16) std::int32_t indices[4];
+                _mm_store_si128(reinterpret_cast<__m128i*>(indices), quantized);
+                quantized = _mm_setr_epi32(pLUT[indices[0]], pLUT[indices[1]], pLUT[indices[2]], 0);
+            }
 
-        if (fp) {
-            // Header
-            std::fprintf(fp, "P7\nWIDTH %d\nHEIGHT %d\nDEPTH 4\n MAXVAL 255\nTUPLTYPE RGB_ALPHA\nENDHDR\n", this->m_width, this->m_height);
+            return _mm_or_si128(_mm_andnot_si128(alphaMask, quantized), alpha);
+        };
 
-            // Write Contents
-            std::fwrite(this->m_pBuff.get(), this->m_nPixels * sizeof(Coloru8), 1u, fp);
+        size_t i = 0u;
+        for (; i + 4u <= count; i += 4u) {
+            const __m128i p01 = _mm_packs_epi32(ResolvePixel(pSrc[i + 0u]), ResolvePixel(pSrc[i + 1u]));
+            const __m128i p23 = _mm_packs_epi32(ResolvePixel(pSrc[i + 2u]), ResolvePixel(pSrc[i + 3u]));
 
-            // Close
-            std::fclose(fp);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(pDst + i), _mm_packus_epi16(p01, p23));
         }
 
-#endif
+        Scalar(pSrc + i, pDst + i, count - i, pLUT);
     }
-}; // Image
 
-std::string GenerateOutputFilename() noexcept { // the filename w/o the extension
-    const std::time_t cTime = std::time(NULL);
-    const std::tm* timePtr = std::localtime(&cTime);
+    // Two Pixels Per Register (A Separate Function Since Lambdas Don't Inherit The Target Attribute)
+    POLAR_TARGET_AVX2 inline __m256i ResolvePixelPairAVX2(const Colorf32* pPixels, const __m256 scale, const std::int32_t* pLUT) noexcept {
+        const __m256 zero        = _mm256_setzero_ps();
+        const __m256 value       = _mm256_loadu_ps(&pPixels->r);
+        const __m256 sampleCount = _mm256_permute_ps(value, _MM_SHUFFLE(3, 3, 3, 3));
+        const __m256 normalized  = _mm256_and_ps(_mm256_div_ps(value, sampleCount), _mm256_cmp_ps(sampleCount, zero, _CMP_GT_OQ));
 
-    char buff[100] = { 0 }; // filename
-    std::snprintf(buff, sizeof(buff), "frame-%d-%d-%d, %d-%d-%d", timePtr->tm_mday, timePtr->tm_mon, timePtr->tm_year, timePtr->tm_hour, timePtr->tm_min, timePtr->tm_sec);
+        __m256i quantized = _mm256_cvtps_epi32(_mm256_mul_ps(_mm256_min_ps(_mm256_max_ps(normalized, zero), _mm256_set1_ps(1.f)), scale));
 
-    return std::string(buff);
-}
+        if (pLUT)
+            quantized = _mm256_i32gather_epi32(pLUT, quantized, 4);
 
-struct CommandLineArguments {
-    std::uint16_t surfaceWidth;
-    std::uint16_t surfaceHeight;
-}; // CommandLineArguments
+        return _mm256_blend_epi32(quantized, _mm256_set1_epi32(255), 0x88);
+    }
 
-CommandLineArguments ParseCommandLineArguments(int argc, char** argv) noexcept {
-    CommandLineArguments result;
+    POLAR_TARGET_AVX2 void AVX2(const Colorf32* pSrc, Coloru8* pDst, const size_t count, const std::int32_t* pLUT) noexcept {
+        const __m256  scale     = _mm256_set1_ps(pLUT ? static_cast<float>(ToneMappingLUT::SIZE - 1u) : 255.f);
+        const __m256i packOrder = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
 
-    auto ExtractCommandLineValueForOption = [argc, argv](const char* option) {
-        for (size_t i = 1u; i < argc; ++i)
-            if (std::strcmp(argv[i], option) == 0)
-                return argv[i + 1];
+        size_t i = 0u;
+        for (; i + 8u <= count; i += 8u) {
+            // The Packs Work Within 128-Bit Lanes, Leaving The Pixels In 0 2 4 6 | 1 3 5 7 Order
+            const __m256i p0213 = _mm256_packs_epi32(ResolvePixelPairAVX2(pSrc + i + 0u, scale, pLUT), ResolvePixelPairAVX2(pSrc + i + 2u, scale, pLUT));
+            const __m256i p4657 = _mm256_packs_epi32(ResolvePixelPairAVX2(pSrc + i + 4u, scale, pLUT), ResolvePixelPairAVX2(pSrc + i + 6u, scale, pLUT));
+            const __m256i packed = _mm256_packus_epi16(p0213, p4657);
 
-        throw std::runtime_error("Missing Command Line Argument !");
-    };
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(pDst + i), _mm256_permutevar8x32_epi32(packed, packOrder));
+        }
 
-    result.surfaceWidth = std::atoi(ExtractCommandLineValueForOption("-w"));
-    result.surfaceHeight = std::atoi(ExtractCommandLineValueForOption("-h"));
+        SSE2(pSrc + i, pDst + i, count - i, pLUT);
+    }
 
-    return result;
-}
+    bool CpuSupportsAVX2() noexcept {
+#if defined(_MSC_VER) && !defined(__clang__)
+        int info[4];
+        __cpuid(info, 0);
+        if (info[0] < 7)
+            return false;
 
-void InitOSApis() {
-#ifdef _WIN32
+        __cpuid(info, 1);
+        const bool bOSXSave = info[2] & (1 << 27);
+        const bool bAVX     = info[2] & (1 << 28);
 
-    if (CoInitialize(NULL) != S_OK)
-        THROW_FATAL_ERROR("[COM] Failed To Init COM");
+        __cpuidex(info, 7, 0);
+        const bool bAVX2 = info[1] & (1 << 5);
 
-#endif // _WIN32
+        // The OS Must Also Save The YMM Registers
+        return bOSXSave && bAVX && bAVX2 && ((_xgetbv(0) & 6u) == 6u);
+#else
+        return __builtin_cpu_supports("avx2");
+#endif
+    }
+
+#endif // POLAR_X86
+
+}; // namespace Resolve
+
+// Normalizes & Tone Maps The Accumulation Buffer Into 8-Bit Pixels Using SIMD On Every Core
+void ResolveAccumulation(const Colorf32* pSrc, Coloru8* pDst, const size_t count, const ToneMapping toneMapping) {
+    const ToneMappingLUT lut(toneMapping);
+    const std::int32_t*  pLUT = (toneMapping == ToneMapping::eLinear) ? nullptr : lut.GetData();
+
+    auto resolve = Resolve::Scalar;
+#ifdef POLAR_X86
+    resolve = Resolve::CpuSupportsAVX2() ? Resolve::AVX2 : Resolve::SSE2;
+#endif
+
+    ParallelFor(count, 1u << 16, [&](const size_t begin, const size_t end) {
+        resolve(pSrc + begin, pDst + begin, end - begin, pLUT);
+    });
 }
 
-void UninitOSApis() {
-#ifdef _WIN32
+// IEEE 754 Half To Float, For The Words Written By GLSL's packHalf2x16
+inline float HalfToFloat(const std::uint16_t half) noexcept {
+    const std::uint32_t exponent = (half >> 10u) & 0x1Fu;
+    const std::uint32_t mantissa = half & 0x3FFu;
 
-    CoUninitialize();
+    float value = 0.f;
+    if (exponent == 0u)
+        value = std::ldexp(static_cast<float>(mantissa), -24); // Subnormal
+    else if (exponent == 31u)
+        value = mantissa ? std::numeric_limits<float>::quiet_NaN() : std::numeric_limits<float>::infinity();
+    else
+        value = std::ldexp(static_cast<float>(mantissa | 0x400u), static_cast<int>(exponent) - 25);
 
-#endif // _WIN32
+    return (half & 0x8000u) ? -value : value;
 }
 
-class VulkanBuffer {
-private:
-    size_t m_size;
+// A Pixel Of An eRGBA16F Accumulation (common.glsl's StoreAccumulation) As The Sums & Sample Count The Host Works With
+inline Colorf32 DecodeHalfAccumulation(const std::uint32_t* pWords) noexcept {
+    const float sampleCount = static_cast<float>(pWords[1] >> 16u);
 
-    const vk::Device& m_device;
+    return Colorf32{
+        HalfToFloat(static_cast<std::uint16_t>(pWords[0]))       * sampleCount,
+        HalfToFloat(static_cast<std::uint16_t>(pWords[0] >> 16u)) * sampleCount,
+        HalfToFloat(static_cast<std::uint16_t>(pWords[1]))       * sampleCount,
+        sampleCount
+    };
+}
 
-    vk::Buffer       m_buffer;
-    vk::DeviceMemory m_memory;
+// A Word Of resolve.glsl's GpuResolve::eRGB9E5 Output: Three 9-Bit Mantissas & A 5-Bit Exponent Biased By 15, As A Mean (.a = 1)
+inline Colorf32 DecodeRGB9E5(const std::uint32_t word) noexcept {
+    const float scale = std::ldexp(1.f, static_cast<int>(word >> 27u) - 15 - 9);
 
-public:
-    VulkanBuffer() = default;
+    return Colorf32{ (word & 0x1FFu) * scale, ((word >> 9u) & 0x1FFu) * scale, ((word >> 18u) & 0x1FFu) * scale, 1.f };
+}
 
-    VulkanBuffer(const vk::Device& device, const size_t size, const vk::BufferUsageFlagBits& usage, const std::vector<std::uint32_t>& queues) noexcept
-        : m_size(size), m_device(device)
-    {
-        // Create The Buffer
-        const auto bufferCreateInfo = vk::BufferCreateInfo(
-            vk::BufferCreateFlags{}, this->m_size,
-            usage,                   vk::SharingMode::eExclusive,
-            queues.size(),           queues.data()
-        );
+// Edge-Aware À-Trous Wavelet Filter (Dammertz et al., "Edge-Avoiding À-Trous Wavelet Transform For Fast Global Illumination Filtering", 2010)
+// Guided By The First-Hit AOVs. It Filters The Illumination (Color Divided By Albedo) & Multiplies The Albedo Back, So Textures Stay Sharp
+namespace Denoiser {
+
+    constexpr std::uint32_t ITERATION_COUNT = 5u;    // Taps 1, 2, 4, 8 & 16 Pixels Apart: A 125 Pixel Wide Footprint
+    constexpr float         COLOR_SIGMA     = 4.f;   // Relative To The Pair's Mean Intensity
+    constexpr float         COLOR_EPSILON   = 1e-2f;
+    constexpr float         NORMAL_POWER    = 64.f;
+    constexpr float         DEPTH_SIGMA     = 0.05f; // Relative To The Center's Depth, Per Pixel Of Distance
+    constexpr float         ALBEDO_SIGMA    = 0.1f;
+    constexpr float         MIN_ALBEDO      = 1e-3f; // Darker Channels Aren't Demodulated
+
+    constexpr float KERNEL[5] = { 1.f / 16.f, 1.f / 4.f, 3.f / 8.f, 1.f / 4.f, 1.f / 16.f }; // B3 Spline
+
+    // The Averaged Guides Of A Pixel
+    struct Guide {
+        float albedo[3];
+        float depth;     // 0 Where The Camera Rays Missed
+        float normal[3]; // Renormalized, 0 Where The Camera Rays Missed
+    }; // Guide
+
+    // 'pAovs' Holds Two Entries Per Pixel (Albedo & Depth, Normal), Summed Over The Samples Counted By The Accumulation's .a
+    // Writes The Averaged, Filtered Colors To 'pDst' With .a = 1 So That ResolveAccumulation Can Tone Map Them
+    void Denoise(const Colorf32* pAccumulation, const Colorf32* pAovs, Colorf32* pDst, const std::uint32_t width, const std::uint32_t height) {
+        const size_t pixelCount = static_cast<size_t>(width) * height;
+
+        std::vector<Guide> guides(pixelCount);
+        std::vector<float> illumination(3u * pixelCount), filtered(3u * pixelCount);
+
+        ParallelFor(pixelCount, 1u << 14, [&](const size_t begin, const size_t end) {
+            for (size_t i = begin; i < end; i++) {
+                const float inverseCount = (pAccumulation[i].a > 0.f) ? (1.f / pAccumulation[i].a) : 0.f;
+
+                const Colorf32& albedoDepth = pAovs[2u * i];
+                const Colorf32& normal      = pAovs[2u * i + 1u];
+                const float     color[3]    = { pAccumulation[i].r * inverseCount, pAccumulation[i].g * inverseCount, pAccumulation[i].b * inverseCount };
+
+                Guide& guide = guides[i];
+                guide.albedo[0] = albedoDepth.r * inverseCount;
+                guide.albedo[1] = albedoDepth.g * inverseCount;
+                guide.albedo[2] = albedoDepth.b * inverseCount;
+                guide.depth     = albedoDepth.a * inverseCount;
+
+                const float normalLength = std::sqrt(normal.r * normal.r + normal.g * normal.g + normal.b * normal.b);
+                const float normalScale  = (normalLength > 0.f) ? (1.f / normalLength) : 0.f;
+                guide.normal[0] = normal.r * normalScale;
+                guide.normal[1] = normal.g * normalScale;
+                guide.normal[2] = normal.b * normalScale;
+
+                for (size_t c = 0u; c < 3u; c++)
+                    illumination[3u * i + c] = (guide.albedo[c] > MIN_ALBEDO) ? (color[c] / guide.albedo[c]) : color[c];
+            }
+        });
+
+        for (std::uint32_t iteration = 0u; iteration < ITERATION_COUNT; iteration++) {
+            const std::int32_t step                  = 1 << iteration;
+            const float        colorSigma            = COLOR_SIGMA / std::sqrt(static_cast<float>(step));
+            const float        inverseColorVariance  = 1.f / (colorSigma * colorSigma);
+            const float        inverseAlbedoVariance = 1.f / (ALBEDO_SIGMA * ALBEDO_SIGMA);
+
+            ParallelFor(height, 16u, [&](const size_t rowBegin, const size_t rowEnd) {
+                for (size_t y = rowBegin; y < rowEnd; y++) {
+                    for (size_t x = 0u; x < width; x++) {
+                        const size_t p      = y * width + x;
+                        const Guide& center = guides[p];
+                        const bool   bHit   = center.depth > 0.f;
+
+                        float sum[3] = { 0.f, 0.f, 0.f }, weightSum = 0.f;
+                        for (std::int32_t ky = 0; ky < 5; ky++) {
+                            const std::int64_t qy = static_cast<std::int64_t>(y) + (ky - 2) * step;
+                            if (qy < 0 || qy >= height)
+                                continue;
+
+                            for (std::int32_t kx = 0; kx < 5; kx++) {
+                                const std::int64_t qx = static_cast<std::int64_t>(x) + (kx - 2) * step;
+                                if (qx < 0 || qx >= width)
+                                    continue;
+
+                                const size_t q     = static_cast<size_t>(qy) * width + static_cast<size_t>(qx);
+                                const Guide& other = guides[q];
+
+                                // Never Blend Surfaces With The Background
+                                if (bHit != (other.depth > 0.f))
+                                    continue;
+
+                                float colorDistance = 0.f, albedoDistance = 0.f, colorScale = 0.f;
+                                for (size_t c = 0u; c < 3u; c++) {
+                                    const float dc = illumination[3u * p + c] - illumination[3u * q + c];
+                                    const float da = center.albedo[c] - other.albedo[c];
+                                    colorDistance  += dc * dc;
+                                    albedoDistance += da * da;
+                                    colorScale     += illumination[3u * p + c] + illumination[3u * q + c];
+                                }
+                                colorScale = colorScale / 6.f + COLOR_EPSILON;
+
+                                float weight = KERNEL[kx] * KERNEL[ky] * std::exp(-colorDistance * inverseColorVariance / (colorScale * colorScale) - albedoDistance * inverseAlbedoVariance);
+
+                                if (bHit) {
+                                    const float cosNormals = center.normal[0] * other.normal[0] + center.normal[1] * other.normal[1] + center.normal[2] * other.normal[2];
+                                    const float distance   = static_cast<float>(step) * std::sqrt(static_cast<float>((kx - 2) * (kx - 2) + (ky - 2) * (ky - 2)));
+
+                                    weight *= std::pow(std::max(0.f, cosNormals), NORMAL_POWER);
+                                    weight *= std::exp(-std::abs(center.depth - other.depth) / (DEPTH_SIGMA * center.depth * std::max(1.f, distance)));
+                                }
+
+                                for (size_t c = 0u; c < 3u; c++)
+                                    sum[c] += weight * illumination[3u * q + c];
+                                weightSum += weight;
+                            }
+                        }
+
+                        // Only Zero When The Samples' Normals Cancel Out, Which Leaves The Pixel As It Is
+                        for (size_t c = 0u; c < 3u; c++)
+                            filtered[3u * p + c] = (weightSum > 0.f) ? (sum[c] / weightSum) : illumination[3u * p + c];
+                    }
+                }
+            });
+
+            illumination.swap(filtered);
+        }
 
-        this->m_buffer = device.createBuffer(bufferCreateInfo);
+        ParallelFor(pixelCount, 1u << 14, [&](const size_t begin, const size_t end) {
+            for (size_t i = begin; i < end; i++) {
+                float color[3];
+                for (size_t c = 0u; c < 3u; c++)
+                    color[c] = (guides[i].albedo[c] > MIN_ALBEDO) ? (illumination[3u * i + c] * guides[i].albedo[c]) : illumination[3u * i + c];
+
+                pDst[i] = Colorf32{ color[0], color[1], color[2], 1.f };
+            }
+        });
     }
 
-    void Allocate(const vk::PhysicalDevice& physicalDevice, const vk::MemoryPropertyFlags& memoryRequirements) noexcept {
-        // Prelogue
-        const auto physicalDeviceMemoryProperties = physicalDevice.getMemoryProperties();
+}; // namespace Denoiser
 
-        // Pick A Compatible Memory Type And Get Its Index
-        const auto bufferMemoryRequirements = this->m_device.getBufferMemoryRequirements(this->m_buffer);
+enum class ImageFormat {
+    ePNG,
+    eQOI,
+    ePAM
+}; // ImageFormat
 
-        for (std::uint32_t i = 0u; i < physicalDeviceMemoryProperties.memoryTypeCount; i++) {
-            const bool condition0 = bufferMemoryRequirements.memoryTypeBits & (1 << i);
-            const bool condition1 = (physicalDeviceMemoryProperties.memoryTypes[i].propertyFlags & memoryRequirements) == memoryRequirements;
+// --format's Values, Anything Else Is PNG
+inline ImageFormat ParseImageFormat(const std::string& name) noexcept {
+    return (name == "qoi") ? ImageFormat::eQOI : (name == "pam") ? ImageFormat::ePAM : ImageFormat::ePNG;
+}
 
-            if (condition0 && condition1) {
-                // When Compatible
-                // Allocate Buffer Memory
-                const auto memoryAllocateInfo = vk::MemoryAllocateInfo(bufferMemoryRequirements.size, i);
-                this->m_memory = this->m_device.allocateMemory(memoryAllocateInfo);
-                return;
+inline const char* GetImageFileExtension(const ImageFormat format) noexcept {
+    return (format == ImageFormat::ePNG) ? ".png" : (format == ImageFormat::eQOI) ? ".qoi" : ".pam";
+}
+
+// Big-Endian Helpers For PNG & QOI
+inline void AppendU32BE(std::vector<std::uint8_t>& out, const std::uint32_t value) {
+    out.push_back(static_cast<std::uint8_t>(value >> 24));
+    out.push_back(static_cast<std::uint8_t>(value >> 16));
+    out.push_back(static_cast<std::uint8_t>(value >> 8));
+    out.push_back(static_cast<std::uint8_t>(value));
+}
+
+#ifndef _WIN32 // Windows Uses WIC To Write PNGs
+
+// One IDAT Chunk Of A PNG & The Adler-32 Of The Filtered Rows It Deflates
+struct PngStrip {
+    std::vector<std::uint8_t> chunk; // A Complete IDAT Chunk, Less Its CRC
+    uLong adler;
+    uLong filteredSize;
+}; // PngStrip
+
+// Filters & Deflates 'rowCount' Rows Into A Strip, 'pAbove' Being The Row Before The First One (nullptr At The Top Of The Image)
+// The Image's First Strip Starts The zlib Stream & Its Last One Leaves Room For The Adler-32, Every Other Strip Ends With
+// A Sync Flush, So The Raw Deflate Streams Concatenate Into One Valid zlib Stream (Whose Adler-32 Is Combined)
+bool EncodePngStrip(const Coloru8* pRows, const Coloru8* pAbove, const std::uint32_t width, const std::uint32_t rowCount,
+                    const bool bFirst, const bool bLast, PngStrip& strip) {
+    const size_t rowSize = static_cast<size_t>(width) * sizeof(Coloru8);
+
+    // Filter Every Row, Keeping Whichever Filter Minimizes The Sum Of Absolute Residuals
+    std::vector<std::uint8_t> filtered;
+    filtered.reserve(rowCount * (rowSize + 1u));
+
+    std::vector<std::uint8_t> candidates[4];
+    for (std::uint32_t y = 0u; y < rowCount; y++) {
+        const std::uint8_t* pRow      = reinterpret_cast<const std::uint8_t*>(pRows + static_cast<size_t>(y) * width);
+        const std::uint8_t* pAboveRow = (y > 0u) ? (pRow - rowSize) : reinterpret_cast<const std::uint8_t*>(pAbove);
+
+        size_t bestFilter = 0u, bestScore = SIZE_MAX;
+        for (size_t f = 0u; f < 4u; f++) { // None, Sub, Up, Paeth
+            std::vector<std::uint8_t>& candidate = candidates[f];
+            candidate.resize(rowSize);
+
+            size_t score = 0u;
+            for (size_t i = 0u; i < rowSize; i++) {
+                const int a = (i >= 4u) ? pRow[i - 4u] : 0;
+                const int b = pAboveRow ? pAboveRow[i] : 0;
+                const int c = (pAboveRow && i >= 4u) ? pAboveRow[i - 4u] : 0;
+
+                int predictor = 0;
+                if (f == 1u) {
+                    predictor = a;
+                } else if (f == 2u) {
+                    predictor = b;
+                } else if (f == 3u) {
+                    const int p = a + b - c, pa = std::abs(p - a), pb = std::abs(p - b), pc = std::abs(p - c);
+                    predictor = (pa <= pb && pa <= pc) ? a : (pb <= pc) ? b : c;
+                }
+
+                candidate[i] = static_cast<std::uint8_t>(pRow[i] - predictor);
+                score += std::abs(static_cast<std::int8_t>(candidate[i]));
+            }
+
+            if (score < bestScore) {
+                bestScore  = score;
+                bestFilter = f;
             }
         }
 
-        throw std::runtime_error("Could not find a suitable memory type to allocate a buffer");
+        filtered.push_back(static_cast<std::uint8_t>(bestFilter == 3u ? 4u : bestFilter)); // Paeth Is Filter Type 4
+        filtered.insert(filtered.end(), candidates[bestFilter].begin(), candidates[bestFilter].end());
     }
 
-    void Bind() const noexcept {
-        // TODO: use one big buffer with suballocations
-        this->m_device.bindBufferMemory(this->m_buffer, this->m_memory, 0u);
-    }
+    strip.adler        = adler32(adler32(0L, Z_NULL, 0), filtered.data(), static_cast<uInt>(filtered.size()));
+    strip.filteredSize = static_cast<uLong>(filtered.size());
 
-    void* MapMemory() const noexcept {
-        return this->m_device.mapMemory(this->m_memory, 0u, this->m_size);
-    }
+    // Raw Deflate (No zlib Header), The Header & Checksum Are Added Around The Strips
+    z_stream stream = {};
+    if (deflateInit2(&stream, 6, Z_DEFLATED, -15, 8, Z_DEFAULT_STRATEGY) != Z_OK)
+        return false;
 
-    void UnMapMemory() const noexcept {
-        this->m_device.unmapMemory(this->m_memory);
+    std::vector<std::uint8_t>& chunk = strip.chunk;
+    chunk.resize(8u + (bFirst ? 2u : 0u));
+    if (bFirst) {
+        chunk[8] = 0x78; // Deflate, 32KiB Window
+        chunk[9] = 0x9C; // Default Compression
     }
 
-    void UnAllocate() const noexcept {
-        this->m_device.freeMemory(this->m_memory);
-    }
+    size_t compressedSize = chunk.size();
+    chunk.resize(compressedSize + deflateBound(&stream, static_cast<uLong>(filtered.size())) + 16u);
 
-    void Destroy() const noexcept {
-        this->m_device.destroyBuffer(this->m_buffer);
-    }
+    stream.next_in   = filtered.data();
+    stream.avail_in  = static_cast<uInt>(filtered.size());
+    stream.next_out  = chunk.data() + compressedSize;
+    stream.avail_out = static_cast<uInt>(chunk.size() - compressedSize);
 
-    vk::DescriptorBufferInfo GetDescriptorBufferInfo() const noexcept {
-        return vk::DescriptorBufferInfo(this->m_buffer, 0, this->m_size);
-    }
+    const int  result    = deflate(&stream, bLast ? Z_FINISH : Z_SYNC_FLUSH);
+    const bool bDeflated = result == (bLast ? Z_STREAM_END : Z_OK);
 
-    const vk::Buffer&       GetBuffer()       const noexcept { return this->m_buffer; }
-    const vk::DeviceMemory& GetDeviceMemory() const noexcept { return this->m_memory; }
-};
+    compressedSize = chunk.size() - stream.avail_out;
+    deflateEnd(&stream);
 
-int main(int argc, char** argv) {
-    InitOSApis();
+    chunk.resize(compressedSize);
+    if (bLast)
+        chunk.resize(chunk.size() + 4u); // Room For The Adler-32, Written Once All Strips Are Known
 
-    const auto commandLineArguments = ParseCommandLineArguments(argc, argv);
+    // Chunk Length & Type
+    const std::uint32_t dataSize = static_cast<std::uint32_t>(chunk.size() - 8u);
+    chunk[0] = static_cast<std::uint8_t>(dataSize >> 24); chunk[1] = static_cast<std::uint8_t>(dataSize >> 16);
+    chunk[2] = static_cast<std::uint8_t>(dataSize >> 8);  chunk[3] = static_cast<std::uint8_t>(dataSize);
+    std::memcpy(chunk.data() + 4u, "IDAT", 4u);
 
-    std::printf("Width: %d, Height: %d\n", commandLineArguments.surfaceWidth, commandLineArguments.surfaceHeight);
+    return bDeflated;
+}
 
-    try {
-#ifndef _DEBUG
-        constexpr std::uint32_t validationLayerCount = 0u;
-#else
-        constexpr std::uint32_t validationLayerCount = 1u;
-#endif
+// Appends The Chunk's CRC (Over Its Type & Data) & Writes It
+bool WritePngChunk(FILE* fp, std::vector<std::uint8_t>& chunk) {
+    AppendU32BE(chunk, static_cast<std::uint32_t>(crc32(crc32(0L, Z_NULL, 0), chunk.data() + 4u, static_cast<uInt>(chunk.size() - 4u))));
+    return std::fwrite(chunk.data(), chunk.size(), 1u, fp) == 1u;
+}
 
-        constexpr std::array<const char*, 1u> validationLayers = { "VK_LAYER_KHRONOS_validation" };
+#endif // _WIN32
 
-        vk::Instance instance;
-        { // Create Instance
-            constexpr auto appInfo = vk::ApplicationInfo(
-                "Polar-PTX",
-                VK_MAKE_VERSION(1, 0, 0),
-                "Polar-PTX",
-                VK_MAKE_VERSION(1, 0, 0),
-                VK_MAKE_VERSION(1, 0, 0)
-            );
+// Encodes QOI (https://qoiformat.org/qoi-specification.pdf) Pixels
+// The Format Is Inherently Sequential But Encodes Far Faster Than Deflate, The State Carries Over So That An Image Can Be Encoded In Parts
+struct QoiEncoder {
+    Coloru8       index[64] = {};
+    Coloru8       previous  = { 0u, 0u, 0u, 255u };
+    std::uint32_t run       = 0u;
+
+    // Appends The Next 'count' Pixels, Ending The Pending Run If They Are The Image's Last
+    void Encode(const Coloru8* pPixels, const size_t count, const bool bLast, std::vector<std::uint8_t>& out) noexcept {
+        auto SameColor = [](const Coloru8& a, const Coloru8& b) { return a.r == b.r && a.g == b.g && a.b == b.b && a.a == b.a; };
+
+        for (size_t i = 0u; i < count; i++) {
+            const Coloru8& pixel = pPixels[i];
+
+            if (SameColor(pixel, this->previous)) {
+                this->run++;
+                if (this->run == 62u || (bLast && i + 1u == count)) {
+                    out.push_back(static_cast<std::uint8_t>(0xC0 | (this->run - 1u))); // QOI_OP_RUN
+                    this->run = 0u;
+                }
+                continue;
+            }
 
-            const auto instanceCreateInfo = vk::InstanceCreateInfo(
-                vk::InstanceCreateFlags(),
-                &appInfo,
-                validationLayerCount,
-                validationLayers.data(),
-                0u,
-                nullptr
-            );
+            if (this->run > 0u) {
+                out.push_back(static_cast<std::uint8_t>(0xC0 | (this->run - 1u)));
+                this->run = 0u;
+            }
 
-            instance = vk::createInstance(instanceCreateInfo);
+            const std::uint32_t hash = (pixel.r * 3u + pixel.g * 5u + pixel.b * 7u + pixel.a * 11u) % 64u;
+
+            if (SameColor(this->index[hash], pixel)) {
+                out.push_back(static_cast<std::uint8_t>(hash)); // QOI_OP_INDEX
+            } else {
+                this->index[hash] = pixel;
+
+                if (pixel.a == this->previous.a) {
+                    const int dr = static_cast<std::int8_t>(pixel.r - this->previous.r);
+                    const int dg = static_cast<std::int8_t>(pixel.g - this->previous.g);
+                    const int db = static_cast<std::int8_t>(pixel.b - this->previous.b);
+                    const int drdg = dr - dg, dbdg = db - dg;
+
+                    if (dr >= -2 && dr <= 1 && dg >= -2 && dg <= 1 && db >= -2 && db <= 1) {
+                        out.push_back(static_cast<std::uint8_t>(0x40 | ((dr + 2) << 4) | ((dg + 2) << 2) | (db + 2))); // QOI_OP_DIFF
+                    } else if (dg >= -32 && dg <= 31 && drdg >= -8 && drdg <= 7 && dbdg >= -8 && dbdg <= 7) {
+                        out.push_back(static_cast<std::uint8_t>(0x80 | (dg + 32))); // QOI_OP_LUMA
+                        out.push_back(static_cast<std::uint8_t>(((drdg + 8) << 4) | (dbdg + 8)));
+                    } else {
+                        out.insert(out.end(), { 0xFE, pixel.r, pixel.g, pixel.b }); // QOI_OP_RGB
+                    }
+                } else {
+                    out.insert(out.end(), { 0xFF, pixel.r, pixel.g, pixel.b, pixel.a }); // QOI_OP_RGBA
+                }
+            }
+
+            this->previous = pixel;
         }
+    }
+}; // QoiEncoder
 
-        std::uint32_t computeQueueIndex = 0, physicalDeviceScore = 0;
+// Writes An Image Band By Band From Top To Bottom, So Only One Band Of Rows Has To Be In Memory At A Time
+// PNG Bands Are Cut Into Strips Deflated In Parallel, QOI's Encoder Carries On From Band To Band & PAM Rows Are Written As Is
+class ImageWriter {
+private:
+    const ImageFormat   m_format;
+    const std::uint32_t m_width;
+    const std::uint32_t m_height;
+    const std::string   m_filename; // Including The Extension
 
-        vk::PhysicalDevice                     physicalDevice;
-        vk::PhysicalDeviceProperties           physicalDeviceProperties;
-        vk::PhysicalDeviceMemoryProperties     physicalDeviceMemoryProperties;
-        std::vector<vk::QueueFamilyProperties> physicalDeviceQueueFamilyProperties;
+    std::uint32_t m_rowsWritten = 0u;
+    FILE*         m_fp          = nullptr;
 
-        { // Pick Physical Devices
-            bool bPickedPhysicalDevice = false;
+#ifdef _WIN32
+    Microsoft::WRL::ComPtr<IWICImagingFactory>    m_factory;
+    Microsoft::WRL::ComPtr<IWICBitmapEncoder>     m_bitmapEncoder;
+    Microsoft::WRL::ComPtr<IWICBitmapFrameEncode> m_bitmapFrame;
+    Microsoft::WRL::ComPtr<IWICStream>            m_outputStream;
+#else
+    std::vector<Coloru8> m_lastRow; // PNG: The Previous Band's Last Row, Which The Up & Paeth Filters Predict From
+    uLong                m_adler;   // PNG: The Adler-32 Of Every Row Filtered So Far
+#endif
 
-            const auto devices = instance.enumeratePhysicalDevices();
+    QoiEncoder m_qoiEncoder;
 
-            if (!devices.size())
-                throw std::runtime_error("No Physical Devices Found");
+#ifndef _WIN32
+    // Deflates A Band's Strips In Parallel & Chains Their Checksums Onto The Image's, Closing The zlib Stream With The Last Band
+    bool WritePngRows(const Coloru8* pRows, const std::uint32_t rowCount, const bool bFirst, const bool bLast) {
+        const size_t        threadCount  = std::max(1u, std::thread::hardware_concurrency());
+        const std::uint32_t rowsPerStrip = std::max<std::uint32_t>(16u, static_cast<std::uint32_t>((rowCount + threadCount * 2u - 1u) / (threadCount * 2u)));
+        const std::uint32_t stripCount   = (rowCount + rowsPerStrip - 1u) / rowsPerStrip;
 
-            // Loop through each device to find the best compatible one by scoring them
-            for (const auto& currentDevice : devices) {
-                physicalDevice = currentDevice;
-                physicalDeviceProperties = currentDevice.getProperties();
-                physicalDeviceMemoryProperties = currentDevice.getMemoryProperties();
-                physicalDeviceQueueFamilyProperties = currentDevice.getQueueFamilyProperties();
+        std::vector<PngStrip> strips(stripCount);
+        std::atomic<bool>     bFailed = false;
 
-                // Test Compatibility
-                auto findComputeQueueIndex = [](const vk::QueueFamilyProperties& qfp) {
-                    if ((bool)(qfp.queueFlags & vk::QueueFlagBits::eCompute))
-                        return true;
+        ParallelFor(stripCount, 1u, [&](const size_t begin, const size_t end) {
+            for (size_t s = begin; s < end; s++) {
+                const std::uint32_t firstRow  = static_cast<std::uint32_t>(s) * rowsPerStrip;
+                const Coloru8*      pStripRows = pRows + static_cast<size_t>(firstRow) * this->m_width;
+                const Coloru8*      pAbove     = (s > 0u) ? (pStripRows - this->m_width) : (bFirst ? nullptr : this->m_lastRow.data());
 
-                    return false;
-                };
+                if (!EncodePngStrip(pStripRows, pAbove, this->m_width, std::min(rowsPerStrip, rowCount - firstRow), bFirst && s == 0u, bLast && s + 1u == stripCount, strips[s]))
+                    bFailed = true;
+            }
+        });
 
-                const auto it = std::find_if(physicalDeviceQueueFamilyProperties.begin(), physicalDeviceQueueFamilyProperties.end(), findComputeQueueIndex);
-                if (it == physicalDeviceQueueFamilyProperties.end())
-                    continue;
+        if (bFailed)
+            return false;
 
-                if (physicalDeviceProperties.deviceType != vk::PhysicalDeviceType::eDiscreteGpu)
-                    continue;
+        for (const PngStrip& strip : strips)
+            this->m_adler = adler32_combine(this->m_adler, strip.adler, static_cast<z_off_t>(strip.filteredSize));
 
-                bPickedPhysicalDevice = true;
+        if (bLast) {
+            std::vector<std::uint8_t>& lastChunk = strips.back().chunk;
+            const size_t adlerOffset = lastChunk.size() - 4u;
+            lastChunk[adlerOffset + 0u] = static_cast<std::uint8_t>(this->m_adler >> 24);
+            lastChunk[adlerOffset + 1u] = static_cast<std::uint8_t>(this->m_adler >> 16);
+            lastChunk[adlerOffset + 2u] = static_cast<std::uint8_t>(this->m_adler >> 8);
+            lastChunk[adlerOffset + 3u] = static_cast<std::uint8_t>(this->m_adler);
+        }
 
-                break;
-            }
+        bool bSuccess = true;
+        for (PngStrip& strip : strips)
+            bSuccess = bSuccess && WritePngChunk(this->m_fp, strip.chunk);
 
-            if (!bPickedPhysicalDevice)
-                throw std::runtime_error("No Compatible Physical Device Found");
-        }
+        this->m_lastRow.assign(pRows + static_cast<size_t>(rowCount - 1u) * this->m_width, pRows + static_cast<size_t>(rowCount) * this->m_width);
 
-        vk::Device logicalDevice;
-        { // Create Logical Device
-            const float queuePriority = 1.f;
+        return bSuccess;
+    }
+#endif
 
-            const size_t queueCount = 1u;
-            vk::DeviceQueueCreateInfo queueCreateInfos[queueCount] = {
-                vk::DeviceQueueCreateInfo(vk::DeviceQueueCreateFlags(), computeQueueIndex, 1, &queuePriority)
-            };
+public:
+    // 'filename' Shouldn't Contain The File Extension, Opens The File & Writes The Header
+    ImageWriter(const std::string& filename, const ImageFormat format, const std::uint32_t width, const std::uint32_t height)
+        : m_format(format), m_width(width), m_height(height),
+        m_filename(filename + GetImageFileExtension(format))
+    {
+        if (width == 0u || height == 0u)
+            throw std::runtime_error("Can't Write An Empty Image To " + this->m_filename);
 
-            auto enabledFeatures = vk::PhysicalDeviceFeatures();
+#ifdef _WIN32 // Use WIC (Windows Imaging Component) To Save A .PNG File Natively, Its Frames Take Their Rows Over Several WritePixels Calls
 
-            auto createInfo = vk::DeviceCreateInfo(
-                vk::DeviceCreateFlags(),
-                queueCount,
-                queueCreateInfos,
-                validationLayerCount,
-                validationLayers.data(),
-                0, nullptr, &enabledFeatures
-            );
+        if (format == ImageFormat::ePNG) {
+            const std::wstring fullFilenameW(this->m_filename.begin(), this->m_filename.end());
 
-            logicalDevice = physicalDevice.createDevice(createInfo);
-        }
+            if (CoCreateInstance(CLSID_WICImagingFactory, NULL, CLSCTX_INPROC_SERVER, IID_PPV_ARGS(&this->m_factory)) != S_OK)
+                throw std::runtime_error("[WIC] Could Not Create IWICImagingFactory");
 
-        vk::Queue computeQueue;
-        { // Fetch Queues
-            computeQueue = logicalDevice.getQueue(computeQueueIndex, 0);
-        }
+            if (this->m_factory->CreateStream(&this->m_outputStream) != S_OK)
+                throw std::runtime_error("[WIC] Failed To Create Output Stream");
 
-        const std::vector<std::uint32_t> pQueues = { computeQueueIndex };
-        VulkanBuffer pixelBuffer(logicalDevice, commandLineArguments.surfaceWidth* commandLineArguments.surfaceHeight * sizeof(Colorf32), vk::BufferUsageFlagBits::eStorageBuffer, pQueues);
-        pixelBuffer.Allocate(physicalDevice, vk::MemoryPropertyFlagBits::eHostCoherent | vk::MemoryPropertyFlagBits::eHostVisible | vk::MemoryPropertyFlagBits::eDeviceLocal);
-        pixelBuffer.Bind();
+            if (this->m_outputStream->InitializeFromFilename(fullFilenameW.c_str(), GENERIC_WRITE) != S_OK)
+                throw std::runtime_error("[WIC] Failed To Initialize Output Stream From Filename");
 
-        vk::DescriptorSetLayout        descriptorSetLayout;
-        vk::DescriptorPool             descriptorPool;
-        vk::DescriptorSetAllocateInfo  descriptorSetAllocateInfo;
-        vk::DescriptorSet              descriptorSet;
-        { // Create Descriptors
-            // Create Descriptor Set Layout
-            const std::array<vk::DescriptorSetLayoutBinding, 1u> descriptorSetLayoutBindings = {
-                // PixelBuffer
-                vk::DescriptorSetLayoutBinding(
-                    0u, vk::DescriptorType::eStorageBuffer,
-                    1u, vk::ShaderStageFlagBits::eCompute,
-                    nullptr
-                )
-            };
+            if (this->m_factory->CreateEncoder(GUID_ContainerFormatPng, NULL, &this->m_bitmapEncoder) != S_OK)
+                throw std::runtime_error("[WIC] Failed To Create Bitmap Encoder");
 
-            const auto descriptorSetLayoutCreateInfo = vk::DescriptorSetLayoutCreateInfo(
-                vk::DescriptorSetLayoutCreateFlags{},
-                static_cast<std::uint32_t>(descriptorSetLayoutBindings.size()),
-                descriptorSetLayoutBindings.data()
-            );
+            if (this->m_bitmapEncoder->Initialize(this->m_outputStream.Get(), WICBitmapEncoderNoCache) != S_OK)
+                throw std::runtime_error("[WIC] Failed To Initialize Bitmap ");
 
-            descriptorSetLayout = logicalDevice.createDescriptorSetLayout(descriptorSetLayoutCreateInfo);
+            if (this->m_bitmapEncoder->CreateNewFrame(&this->m_bitmapFrame, NULL) != S_OK)
+                throw std::runtime_error("[WIC] Failed To Create A New Frame");
 
-            // Create Descriptor Pool
-            const auto descriptorPoolSize = vk::DescriptorPoolSize(vk::DescriptorType::eStorageBuffer, 1u);
-            const auto descriptorPoolCreateInfo = vk::DescriptorPoolCreateInfo(vk::DescriptorPoolCreateFlags{}, 1u, 1u, &descriptorPoolSize);
-            descriptorPool = logicalDevice.createDescriptorPool(descriptorPoolCreateInfo);
+            if (this->m_bitmapFrame->Initialize(NULL) != S_OK)
+                throw std::runtime_error("[WIC] Failed To Initialize A Bitmap's Frame");
 
-            // Allocate Descriptor Set
-            auto descriptorSetAllocateInfo = vk::DescriptorSetAllocateInfo(descriptorPool, 1u, &descriptorSetLayout);
-            descriptorSet = std::move(logicalDevice.allocateDescriptorSets(descriptorSetAllocateInfo)[0]);
+            if (this->m_bitmapFrame->SetSize(width, height) != S_OK)
+                throw std::runtime_error("[WIC] Failed To Set A Bitmap's Frame's Size");
 
-            // Initialize Descriptor Set
-            const auto descriptorBufferInfo = pixelBuffer.GetDescriptorBufferInfo();
-            const auto writeDescriptorSet   = vk::WriteDescriptorSet(
-                descriptorSet, 0u, 0u, 1u,
-                vk::DescriptorType::eStorageBuffer, nullptr, &descriptorBufferInfo
-            );
-            logicalDevice.updateDescriptorSets(1u, &writeDescriptorSet, 0, nullptr);
+            const WICPixelFormatGUID desiredPixelFormat = GUID_WICPixelFormat32bppBGRA;
+
+            WICPixelFormatGUID currentPixelFormat = {};
+            if (this->m_bitmapFrame->SetPixelFormat(&currentPixelFormat) != S_OK)
+                throw std::runtime_error("[WIC] Failed To Set Pixel Format On A Bitmap Frame's");
+
+            if (!IsEqualGUID(currentPixelFormat, desiredPixelFormat))
+                throw std::runtime_error("[WIC] The Requested Pixel Format Is Not Supported");
+
+            return;
         }
 
-        vk::ShaderModule   shaderModule;
-        vk::PipelineLayout computePipelineLayout;
-        vk::Pipeline       computePipeline;
-        { // Create The Pipeline
-            // Read Shader Binary File To A Buffer
-            std::ifstream shaderFile("shader.spv", std::ios::binary | std::ios::ate);
-            if (!shaderFile.is_open())
-                throw std::runtime_error("Failed To Open Shader File");
+#else
+        this->m_adler = adler32(0L, Z_NULL, 0);
+#endif
 
-            const size_t codeSize = shaderFile.tellg();
-            std::unique_ptr<char[]> shaderFileBuffer = std::make_unique<char[]>(codeSize);
+        this->m_fp = std::fopen(this->m_filename.c_str(), "wb");
+        if (!this->m_fp)
+            throw std::runtime_error("Failed To Open " + this->m_filename);
+
+        bool bSuccess = false;
+        switch (format) {
+#ifndef _WIN32
+        case ImageFormat::ePNG: {
+            static constexpr std::uint8_t signature[8] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+            bSuccess = std::fwrite(signature, sizeof(signature), 1u, this->m_fp) == 1u;
+
+            std::vector<std::uint8_t> header;
+            AppendU32BE(header, 13u);
+            header.insert(header.end(), { 'I', 'H', 'D', 'R' });
+            AppendU32BE(header, width);
+            AppendU32BE(header, height);
+            header.insert(header.end(), { 8u, 6u, 0u, 0u, 0u }); // 8 Bits, RGBA, Deflate, Adaptive Filtering, No Interlacing
+            bSuccess = bSuccess && WritePngChunk(this->m_fp, header);
+            break;
+        }
+#endif
+        case ImageFormat::eQOI: {
+            std::vector<std::uint8_t> header = { 'q', 'o', 'i', 'f' };
+            AppendU32BE(header, width);
+            AppendU32BE(header, height);
+            header.push_back(4u); // RGBA
+            header.push_back(0u); // sRGB With Linear Alpha
+            bSuccess = std::fwrite(header.data(), header.size(), 1u, this->m_fp) == 1u;
+            break;
+        }
+        default:
+            bSuccess = std::fprintf(this->m_fp, "P7\nWIDTH %u\nHEIGHT %u\nDEPTH 4\nMAXVAL 255\nTUPLTYPE RGB_ALPHA\nENDHDR\n", width, height) > 0;
+            break;
+        }
 
-            shaderFile.seekg(0);
-            shaderFile.read(shaderFileBuffer.get(), codeSize);
-            shaderFile.close();
+        if (!bSuccess)
+            throw std::runtime_error("Failed To Write " + this->m_filename);
+    }
 
-            // Create Shader Module
-            const auto shaderModuleCreateInfo = vk::ShaderModuleCreateInfo(vk::ShaderModuleCreateFlags{}, codeSize, (std::uint32_t*)shaderFileBuffer.get());
-            shaderModule = logicalDevice.createShaderModule(shaderModuleCreateInfo);
+    ImageWriter(const ImageWriter&) = delete;
+    ImageWriter& operator=(const ImageWriter&) = delete;
 
-            const auto shaderStageCreateInfo = vk::PipelineShaderStageCreateInfo(
-                vk::PipelineShaderStageCreateFlags{}, vk::ShaderStageFlagBits::eCompute,
-                shaderModule, "main", nullptr
-            );
+    ~ImageWriter() {
+        if (this->m_fp)
+            std::fclose(this->m_fp);
+    }
 
-            const auto pipelineLayoutCreateInfo = vk::PipelineLayoutCreateInfo(
-                vk::PipelineLayoutCreateFlags{},
-                1u, &descriptorSetLayout,
-                0u, nullptr
-            );
+    // Appends The Next 'rowCount' Rows
+    void WriteRows(const Coloru8* pRows, const std::uint32_t rowCount) {
+        if (rowCount == 0u || rowCount > this->m_height - this->m_rowsWritten)
+            throw std::runtime_error("Too Many Rows Written To " + this->m_filename);
 
-            computePipelineLayout = logicalDevice.createPipelineLayout(pipelineLayoutCreateInfo);
+        const bool   bFirst     = this->m_rowsWritten == 0u;
+        const bool   bLast      = this->m_rowsWritten + rowCount == this->m_height;
+        const size_t pixelCount = static_cast<size_t>(this->m_width) * rowCount;
 
-            const auto computePipelineCreateInfo = vk::ComputePipelineCreateInfo(
-                vk::PipelineCreateFlags{}, shaderStageCreateInfo, computePipelineLayout, {}, 0
-            );
+        bool bSuccess = false;
+        switch (this->m_format) {
+        case ImageFormat::ePNG:
+#ifdef _WIN32
+            bSuccess = this->m_bitmapFrame->WritePixels(rowCount, this->m_width * sizeof(Coloru8), static_cast<UINT>(pixelCount * sizeof(Coloru8)), (BYTE*)pRows) == S_OK;
+#else
+            bSuccess = this->WritePngRows(pRows, rowCount, bFirst, bLast);
+#endif
+            break;
+        case ImageFormat::eQOI: {
+            std::vector<std::uint8_t> out;
+            out.reserve(pixelCount * 2u + 8u);
 
-            computePipeline = logicalDevice.createComputePipeline({}, computePipelineCreateInfo).value;
+            this->m_qoiEncoder.Encode(pRows, pixelCount, bLast, out);
+            if (bLast)
+                out.insert(out.end(), { 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u }); // End Marker
+
+            bSuccess = out.empty() || std::fwrite(out.data(), out.size(), 1u, this->m_fp) == 1u;
+            break;
+        }
+        default:
+            bSuccess = std::fwrite(pRows, pixelCount * sizeof(Coloru8), 1u, this->m_fp) == 1u;
+            break;
         }
 
-        vk::CommandPool   commandPool;
-        vk::CommandBuffer commandBuffer;
-        { // Create Command Pool & Buffer
-            const auto commandPoolCreateInfo = vk::CommandPoolCreateInfo(vk::CommandPoolCreateFlags{}, computeQueueIndex);
-            commandPool = logicalDevice.createCommandPool(commandPoolCreateInfo);
+        if (!bSuccess)
+            throw std::runtime_error("Failed To Write " + this->m_filename);
 
-            const auto commandBufferAllocateInfo = vk::CommandBufferAllocateInfo(commandPool, vk::CommandBufferLevel::ePrimary, 1u);
-            commandBuffer = std::move(logicalDevice.allocateCommandBuffers(commandBufferAllocateInfo)[0]);
-        }
+        this->m_rowsWritten += rowCount;
+    }
 
-        { // Fill Command Buffer
-            const auto commandBufferSubmitInfo = vk::CommandBufferBeginInfo(vk::CommandBufferUsageFlagBits::eOneTimeSubmit, nullptr);
+    // Ends The Image Once Every Row Is Written & Closes The File
+    void Finish() {
+        if (this->m_rowsWritten != this->m_height)
+            throw std::runtime_error(this->m_filename + " Is Missing Rows");
 
-            commandBuffer.begin(commandBufferSubmitInfo);
+#ifdef _WIN32
+        if (this->m_format == ImageFormat::ePNG) {
+            if (this->m_bitmapFrame->Commit() != S_OK)
+                throw std::runtime_error("[WIC] Failed To Commit A Bitmap's Frame");
 
-            commandBuffer.bindPipeline(vk::PipelineBindPoint::eCompute, computePipeline);
-            commandBuffer.bindDescriptorSets(vk::PipelineBindPoint::eCompute, computePipelineLayout, 0, 1u, &descriptorSet, 0, nullptr);
-            commandBuffer.dispatch((uint32_t)std::ceil(commandLineArguments.surfaceWidth / (float)GPU_WORKGROUP_SIZE),
-                (uint32_t)std::ceil(commandLineArguments.surfaceHeight / (float)GPU_WORKGROUP_SIZE), 1);
+            if (this->m_bitmapEncoder->Commit() != S_OK)
+                throw std::runtime_error("[WIC] Failed To Commit Bitmap Encoder");
 
-            commandBuffer.end();
+            return;
         }
+#endif
 
-        vk::Fence fence;
-        { // Create Synch Objects
-            const auto fenceCreateInfo = vk::FenceCreateInfo(vk::FenceCreateFlags{});
+        bool bSuccess = true;
 
-            fence = logicalDevice.createFence(fenceCreateInfo);
+#ifndef _WIN32
+        if (this->m_format == ImageFormat::ePNG) {
+            std::vector<std::uint8_t> end;
+            AppendU32BE(end, 0u);
+            end.insert(end.end(), { 'I', 'E', 'N', 'D' });
+            bSuccess = WritePngChunk(this->m_fp, end);
         }
+#endif
 
-        { // Run
-            const auto submitInfo = vk::SubmitInfo(
-                0, nullptr, nullptr,
-                1u, &commandBuffer,
-                0u, nullptr
-            );
+        bSuccess = std::fclose(this->m_fp) == 0 && bSuccess;
+        this->m_fp = nullptr;
 
-            computeQueue.submit(1u, &submitInfo, fence);
-            logicalDevice.waitForFences(1, &fence, VK_TRUE, UINT64_MAX);
-        }
+        if (!bSuccess)
+            throw std::runtime_error("Failed To Write " + this->m_filename);
+    }
+}; // ImageWriter
+
+// Reads A .pam As ImageWriter Writes It (8-Bit RGB_ALPHA)
+std::vector<Coloru8> ReadPamImage(const std::string& filename, std::uint32_t& width, std::uint32_t& height) {
+    std::ifstream file(filename, std::ios::binary);
+    if (!file.is_open())
+        throw std::runtime_error("Failed To Open " + filename);
+
+    std::string   magic, token;
+    std::uint32_t depth = 0u, maxValue = 0u;
+    width = height = 0u;
+
+    file >> magic;
+    while (file >> token && token != "ENDHDR") {
+        if (token == "WIDTH")         file >> width;
+        else if (token == "HEIGHT")   file >> height;
+        else if (token == "DEPTH")    file >> depth;
+        else if (token == "MAXVAL")   file >> maxValue;
+        else if (token == "TUPLTYPE") file >> token;
+    }
+    file.get(); // The Newline After ENDHDR
 
-        { // Save Image
-            float* f32Image = reinterpret_cast<float*>(pixelBuffer.MapMemory());
+    if (magic != "P7" || token != "ENDHDR" || depth != 4u || maxValue != 255u || width == 0u || height == 0u)
+        throw std::runtime_error(filename + " Is Not An 8-Bit RGBA PAM");
 
-            Image frame(commandLineArguments.surfaceWidth, commandLineArguments.surfaceHeight);
+    std::vector<Coloru8> pixels(static_cast<size_t>(width) * height);
+    if (!file.read(reinterpret_cast<char*>(pixels.data()), pixels.size() * sizeof(Coloru8)))
+        throw std::runtime_error(filename + " Is Truncated");
 
-            for (std::uint32_t i = 0; i < frame.GetPixelCount(); i++) {
-                Coloru8& pixel = frame(i);
-                pixel.r = static_cast<std::uint8_t>(std::clamp(f32Image[i * 4 + 0] * 255.f, 0.f, 255.f));
-                pixel.g = static_cast<std::uint8_t>(std::clamp(f32Image[i * 4 + 1] * 255.f, 0.f, 255.f));
-                pixel.b = static_cast<std::uint8_t>(std::clamp(f32Image[i * 4 + 2] * 255.f, 0.f, 255.f));
-                pixel.a = static_cast<std::uint8_t>(std::clamp(f32Image[i * 4 + 3] * 255.f, 0.f, 255.f));
-            }
+    return pixels;
+}
 
-            pixelBuffer.UnMapMemory();
+// Constants
+class Image {
+private:
+    const std::uint32_t m_width;
+    const std::uint32_t m_height;
+    const size_t        m_nPixels;
 
-            frame.Save(GenerateOutputFilename());
-        }
+    std::unique_ptr<Coloru8[]> m_pBuff;
 
-        { // Destroy Vulkan Objects
-            logicalDevice.destroyFence(fence);
-            logicalDevice.freeCommandBuffers(commandPool, 1u, &commandBuffer);
-            logicalDevice.destroyCommandPool(commandPool);
-            logicalDevice.destroyShaderModule(shaderModule);
-            logicalDevice.destroyPipeline(computePipeline);
-            logicalDevice.destroyPipelineLayout(computePipelineLayout);
-            logicalDevice.resetDescriptorPool(descriptorPool);
-            logicalDevice.destroyDescriptorPool(descriptorPool);
-            logicalDevice.destroyDescriptorSetLayout(descriptorSetLayout);
-            pixelBuffer.UnAllocate();
-            pixelBuffer.Destroy();
-            logicalDevice.destroy();
-            instance.destroy();
+public:
+    Image() = default;
+
+    Image(const std::uint32_t width, const std::uint32_t height) noexcept
+        : m_width(width), m_height(height),
+        m_nPixels(static_cast<size_t>(width)* height)
+    {
+        this->m_pBuff = std::make_unique<Coloru8[]>(this->m_nPixels);
+    }
+
+    inline std::uint32_t GetWidth()      const noexcept { return this->m_width; }
+    inline std::uint32_t GetHeight()     const noexcept { return this->m_height; }
+    inline size_t        GetPixelCount() const noexcept { return this->m_nPixels; }
+
+    inline Coloru8* GetBufferPtr() const noexcept { return this->m_pBuff.get(); }
+
+    inline       Coloru8& operator()(const size_t i)       noexcept { return this->m_pBuff[i]; }
+    inline const Coloru8& operator()(const size_t i) const noexcept { return this->m_pBuff[i]; }
+
+    inline       Coloru8& operator()(const size_t x, const size_t y)       noexcept { return this->m_pBuff[y * this->m_width + this->m_height]; }
+    inline const Coloru8& operator()(const size_t x, const size_t y) const noexcept { return this->m_pBuff[y * this->m_width + this->m_height]; }
+
+    void Save(const std::string& filename, const ImageFormat format = ImageFormat::ePNG) noexcept { // filename shouldn't contain the file extension
+        try {
+            ImageWriter writer(filename, format, this->m_width, this->m_height);
+            writer.WriteRows(this->m_pBuff.get(), this->m_height);
+            writer.Finish();
+        } catch (const std::exception& err) {
+            THROW_FATAL_ERROR(err.what());
+        }
+    }
+}; // Image
+
+std::string GenerateOutputFilename() noexcept { // the filename w/o the extension
+    const std::time_t cTime = std::time(NULL);
+    const std::tm* timePtr = std::localtime(&cTime);
+
+    char buff[100] = { 0 }; // filename
+    std::snprintf(buff, sizeof(buff), "frame-%d-%d-%d, %d-%d-%d", timePtr->tm_mday, timePtr->tm_mon, timePtr->tm_year, timePtr->tm_hour, timePtr->tm_min, timePtr->tm_sec);
+
+    return std::string(buff);
+}
+
+struct Camera {
+    float position[3] = { 0.f, 0.f, 0.f };
+    float target[3]   = { 0.f, 0.f, 1.f };
+}; // Camera
+
+// Reads Keyframes ("px py pz tx ty tz" Per Line, '#' Starts A Comment) And Spreads Them Evenly Over 'frameCount' Frames
+// Without A File, Every Frame Uses 'defaultCamera' (The Scene's)
+std::vector<Camera> LoadCameraPath(const std::string& filename, const std::uint32_t frameCount, const Camera& defaultCamera) {
+    std::vector<Camera> keyframes;
+
+    if (!filename.empty()) {
+        std::ifstream file(filename);
+        if (!file.is_open())
+            throw std::runtime_error("Failed To Open Camera Path " + filename);
+
+        std::string line;
+        for (size_t lineNumber = 1u; std::getline(file, line); lineNumber++) {
+            line = line.substr(0u, line.find('#'));
+            if (line.find_first_not_of(" \t\r") == std::string::npos)
+                continue;
+
+            Camera keyframe;
+            std::istringstream stream(line);
+            if (!(stream >> keyframe.position[0] >> keyframe.position[1] >> keyframe.position[2] >> keyframe.target[0] >> keyframe.target[1] >> keyframe.target[2]))
+                throw std::runtime_error("Invalid Camera Keyframe On Line " + std::to_string(lineNumber) + " Of " + filename);
+
+            keyframes.push_back(keyframe);
+        }
+
+        if (keyframes.empty())
+            throw std::runtime_error("No Camera Keyframes In " + filename);
+    } else {
+        keyframes.push_back(defaultCamera);
+    }
+
+    std::vector<Camera> cameras(frameCount);
+    for (std::uint32_t f = 0u; f < frameCount; f++) {
+        // Linear Interpolation Between The Two Surrounding Keyframes
+        const float  t     = (frameCount > 1u) ? (f * (keyframes.size() - 1u) / static_cast<float>(frameCount - 1u)) : 0.f;
+        const size_t i     = std::min(static_cast<size_t>(t), keyframes.size() - 1u);
+        const size_t j     = std::min(i + 1u, keyframes.size() - 1u);
+        const float  alpha = t - i;
+
+        for (size_t c = 0u; c < 3u; c++) {
+            cameras[f].position[c] = keyframes[i].position[c] + (keyframes[j].position[c] - keyframes[i].position[c]) * alpha;
+            cameras[f].target[c]   = keyframes[i].target[c]   + (keyframes[j].target[c]   - keyframes[i].target[c])   * alpha;
+        }
+    }
+
+    return cameras;
+}
+
+// Mirrors The Shader's Scene Structs (std430)
+struct SceneMaterial {
+    float diffuseColor[4];
+    float emittance[4];
+}; // SceneMaterial
+
+constexpr std::uint32_t SCENE_NO_LIGHT = 0xffffffffu; // The lightIndex Of Primitives That Don't Emit
+
+struct SceneSphere {
+    float         center[3];
+    float         radius;
+    std::uint32_t materialIndex;
+    std::uint32_t lightIndex; // Assigned When The Scene Is Built
+    std::uint32_t padding[2];
+}; // SceneSphere
+
+struct ScenePlane {
+    float         point[3];
+    std::uint32_t materialIndex;
+    float         normal[3];
+    float         padding;
+}; // ScenePlane
+
+// Edges Are Precomputed For The Moller-Trumbore Test
+struct SceneTriangle {
+    float         v0[3];
+    std::uint32_t materialIndex;
+    float         edge1[3];
+    std::uint32_t lightIndex; // Assigned When The Scene Is Built
+    float         edge2[3];
+    float         padding1;
+}; // SceneTriangle
+
+// A Leaf Has primitiveCount > 0 & 'index' Is Its First Triangle, An Interior Node's 'index' Is Its Escape Index
+struct SceneBvhNode {
+    float         boundsMin[3];
+    std::uint32_t primitiveCount;
+    float         boundsMax[3];
+    std::uint32_t index;
+}; // SceneBvhNode
+
+enum SceneLightType : std::uint32_t {
+    eSceneLightSphere   = 0u,
+    eSceneLightTriangle = 1u
+}; // SceneLightType
+
+// An Emissive Sphere Or Triangle, Picked For Shadow Rays In Proportion To Its Power
+struct SceneLight {
+    std::uint32_t primitiveType; // SceneLightType
+    std::uint32_t primitiveIndex;
+    float         cdf;           // The Sum Of The Probabilities Up To & Including This Light (The Last One Is 1)
+    float         probability;
+}; // SceneLight
+
+static_assert(sizeof(SceneMaterial) == 32u && sizeof(SceneSphere) == 32u && sizeof(ScenePlane) == 32u, "Must Match The Shader's std430 Strides");
+static_assert(sizeof(SceneTriangle) == 48u && sizeof(SceneBvhNode) == 32u && sizeof(SceneLight) == 16u, "Must Match The Shader's std430 Strides");
+
+enum SceneSection : std::uint32_t {
+    eSceneSectionMaterials = 0u, // Binding 2
+    eSceneSectionSpheres,        // Binding 3
+    eSceneSectionPlanes,         // Binding 4
+    eSceneSectionTriangles,      // Binding 5, In BVH Leaf Order
+    eSceneSectionBvhNodes,       // Binding 6
+    eSceneSectionLights,         // Binding 7
+    SCENE_SECTION_COUNT
+}; // SceneSection
+
+// Streaming Triangle Mesh Loaders: Files Are Read Record By Record, Only The Positions & Indices Are Kept
+namespace MeshLoader {
+
+    struct Mesh {
+        std::vector<std::array<float, 3>> positions;
+        std::vector<std::uint32_t>        indices; // Three Per Triangle
+    }; // Mesh
+
+    // Wavefront OBJ: 'v' & 'f' Statements, Polygons Are Triangulated As Fans, Negative (Relative) Indices Are Supported
+    inline Mesh LoadOBJ(const std::string& filename) {
+        std::ifstream file(filename);
+        if (!file.is_open())
+            throw std::runtime_error("Failed To Open Mesh " + filename);
+
+        Mesh mesh;
+
+        std::string line;
+        std::vector<std::uint32_t> polygon;
+        for (size_t lineNumber = 1u; std::getline(file, line); lineNumber++) {
+            if (line.size() < 2u || line[1] != ' ')
+                continue;
+
+            std::istringstream stream(line.substr(2u));
+
+            if (line[0] == 'v') {
+                std::array<float, 3> position;
+                if (!(stream >> position[0] >> position[1] >> position[2]))
+                    throw std::runtime_error(filename + ":" + std::to_string(lineNumber) + ": Malformed Vertex");
+
+                mesh.positions.push_back(position);
+            } else if (line[0] == 'f') {
+                polygon.clear();
+
+                // v, v/vt, v//vn or v/vt/vn, Only The Position Matters
+                std::string vertex;
+                while (stream >> vertex) {
+                    const long index = std::strtol(vertex.c_str(), nullptr, 10);
+                    const long resolved = (index < 0) ? static_cast<long>(mesh.positions.size()) + index : index - 1;
+
+                    if (resolved < 0 || resolved >= static_cast<long>(mesh.positions.size()))
+                        throw std::runtime_error(filename + ":" + std::to_string(lineNumber) + ": Face Index Out Of Range");
+
+                    polygon.push_back(static_cast<std::uint32_t>(resolved));
+                }
+
+                for (size_t i = 2u; i < polygon.size(); i++)
+                    mesh.indices.insert(mesh.indices.end(), { polygon[0], polygon[i - 1u], polygon[i] });
+            }
+        }
+
+        return mesh;
+    }
+
+    // Stanford PLY, ASCII Or Binary Little Endian: The 'vertex' Element's x/y/z & The 'face' Element's Index List
+    inline Mesh LoadPLY(const std::string& filename) {
+        std::ifstream file(filename, std::ios::binary);
+        if (!file.is_open())
+            throw std::runtime_error("Failed To Open Mesh " + filename);
+
+        struct Property {
+            std::string name;
+            std::string type;
+            std::string countType; // Only Set For Lists
+        }; // Property
+
+        struct Element {
+            std::string           name;
+            size_t                count;
+            std::vector<Property> properties;
+        }; // Element
+
+        // Parse The Header
+        std::vector<Element> elements;
+        bool bBinary = false;
+
+        std::string line;
+        if (!std::getline(file, line) || line.rfind("ply", 0u) != 0u)
+            throw std::runtime_error(filename + " Is Not A PLY File");
+
+        while (std::getline(file, line)) {
+            std::istringstream stream(line);
+            std::string keyword;
+            stream >> keyword;
+
+            if (keyword == "format") {
+                std::string format;
+                stream >> format;
+
+                if (format == "binary_little_endian")
+                    bBinary = true;
+                else if (format != "ascii")
+                    throw std::runtime_error(filename + ": Unsupported PLY Format " + format);
+            } else if (keyword == "element") {
+                Element element;
+                stream >> element.name >> element.count;
+                elements.push_back(element);
+            } else if (keyword == "property" && !elements.empty()) {
+                Property property;
+                stream >> property.type;
+                if (property.type == "list")
+                    stream >> property.countType >> property.type;
+                stream >> property.name;
+
+                elements.back().properties.push_back(property);
+            } else if (keyword == "end_header") {
+                break;
+            }
+        }
+
+        auto GetTypeSize = [&filename](const std::string& type) -> size_t {
+            if (type == "char"  || type == "uchar"  || type == "int8"  || type == "uint8")   return 1u;
+            if (type == "short" || type == "ushort" || type == "int16" || type == "uint16")  return 2u;
+            if (type == "int"   || type == "uint"   || type == "int32" || type == "uint32" || type == "float" || type == "float32") return 4u;
+            if (type == "double" || type == "float64") return 8u;
+
+            throw std::runtime_error(filename + ": Unknown PLY Type " + type);
+        };
+
+        // Reads One Value As A double, Whatever Its Stored Type
+        auto ReadValue = [&](const std::string& type) -> double {
+            if (!bBinary) {
+                double value;
+                if (!(file >> value))
+                    throw std::runtime_error(filename + ": Truncated PLY Data");
+
+                return value;
+            }
+
+            std::uint8_t bytes[8] = { 0u };
+            const size_t size = GetTypeSize(type);
+            if (!file.read(reinterpret_cast<char*>(bytes), size))
+                throw std::runtime_error(filename + ": Truncated PLY Data");
+
+            std::uint64_t raw = 0u;
+            for (size_t i = 0u; i < size; i++)
+                raw |= static_cast<std::uint64_t>(bytes[i]) << (8u * i);
+
+            const bool bSigned = type == "char" || type == "short" || type == "int" || type == "int8" || type == "int16" || type == "int32";
+            if (type == "float" || type == "float32") { float  value; const std::uint32_t bits = static_cast<std::uint32_t>(raw); std::memcpy(&value, &bits, 4u); return value; }
+            if (type == "double" || type == "float64") { double value; std::memcpy(&value, &raw, 8u); return value; }
+            if (bSigned) {
+                const std::uint64_t signBit = 1ull << (8u * size - 1u);
+                return static_cast<double>(static_cast<std::int64_t>((raw ^ signBit) - signBit));
+            }
+
+            return static_cast<double>(raw);
+        };
+
+        Mesh mesh;
+        std::vector<std::uint32_t> polygon;
+
+        for (const Element& element : elements) {
+            const bool bVertex = element.name == "vertex";
+            const bool bFace   = element.name == "face";
+
+            for (size_t record = 0u; record < element.count; record++) {
+                std::array<float, 3> position = { 0.f, 0.f, 0.f };
+
+                for (const Property& property : element.properties) {
+                    if (!property.countType.empty()) {
+                        const size_t count = static_cast<size_t>(ReadValue(property.countType));
+
+                        polygon.clear();
+                        for (size_t i = 0u; i < count; i++)
+                            polygon.push_back(static_cast<std::uint32_t>(ReadValue(property.type)));
+
+                        if (bFace && (property.name == "vertex_indices" || property.name == "vertex_index")) {
+                            for (const std::uint32_t index : polygon)
+                                if (index >= mesh.positions.size())
+                                    throw std::runtime_error(filename + ": Face Index Out Of Range");
+
+                            for (size_t i = 2u; i < polygon.size(); i++)
+                                mesh.indices.insert(mesh.indices.end(), { polygon[0], polygon[i - 1u], polygon[i] });
+                        }
+                    } else {
+                        const double value = ReadValue(property.type);
+
+                        if (bVertex && property.name.size() == 1u && property.name[0] >= 'x' && property.name[0] <= 'z')
+                            position[property.name[0] - 'x'] = static_cast<float>(value);
+                    }
+                }
+
+                if (bVertex)
+                    mesh.positions.push_back(position);
+            }
+        }
+
+        return mesh;
+    }
+
+    inline Mesh Load(const std::string& filename) {
+        const auto extension = std::filesystem::path(filename).extension();
+
+        if (extension == ".obj")
+            return LoadOBJ(filename);
+        if (extension == ".ply")
+            return LoadPLY(filename);
+
+        throw std::runtime_error("Unsupported Mesh Format " + filename);
+    }
+
+}; // namespace MeshLoader
+
+// Binned SAH BVH Over Triangles, Built In Parallel & Flattened Into The Stackless (Threaded) Layout The Shader Walks:
+// Nodes Are Stored In Depth-First Order, An Interior Node's 'index' Is Its Escape Index (Where To Go On A Miss),
+// Its Hit Successor Being The Next Node. Leaves Go To The Next Node Either Way
+namespace Bvh {
+
+    constexpr size_t BIN_COUNT                  = 16u;
+    constexpr size_t MAX_LEAF_SIZE              = 8u;       // Leaves Are Never Larger Than This
+    constexpr size_t PARALLEL_SUBTREE_THRESHOLD = 1u << 14; // Larger Subtrees Are Built On Their Own Thread
+    constexpr size_t PARALLEL_BINNING_THRESHOLD = 1u << 17; // Larger Nodes Are Binned On Every Core
+
+    struct Aabb {
+        float min[3] = {  FLT_MAX,  FLT_MAX,  FLT_MAX };
+        float max[3] = { -FLT_MAX, -FLT_MAX, -FLT_MAX };
+
+        void Grow(const float point[3]) noexcept {
+            for (size_t c = 0u; c < 3u; c++) {
+                this->min[c] = std::min(this->min[c], point[c]);
+                this->max[c] = std::max(this->max[c], point[c]);
+            }
+        }
+
+        void Grow(const Aabb& other) noexcept {
+            this->Grow(other.min);
+            this->Grow(other.max);
+        }
+
+        float GetHalfSurfaceArea() const noexcept {
+            if (this->min[0] > this->max[0])
+                return 0.f;
+
+            const float extent[3] = { this->max[0] - this->min[0], this->max[1] - this->min[1], this->max[2] - this->min[2] };
+            return extent[0] * extent[1] + extent[1] * extent[2] + extent[2] * extent[0];
+        }
+    }; // Aabb
+
+    struct BuildNode {
+        Aabb   bounds;
+        size_t begin, end; // Range In The Primitive Order
+        std::unique_ptr<BuildNode> children[2];
+    }; // BuildNode
+
+    class Builder {
+    private:
+        std::vector<Aabb>                 m_primitiveBounds;
+        std::vector<std::array<float, 3>> m_centroids;
+        std::vector<std::uint32_t>        m_order; // Permuted In Place, Subtrees Own Disjoint Ranges
+
+    private:
+        std::unique_ptr<BuildNode> BuildSubtree(const size_t begin, const size_t end) {
+            auto node = std::make_unique<BuildNode>();
+            node->begin = begin;
+            node->end   = end;
+
+            Aabb centroidBounds;
+            for (size_t i = begin; i < end; i++) {
+                node->bounds.Grow(this->m_primitiveBounds[this->m_order[i]]);
+                centroidBounds.Grow(this->m_centroids[this->m_order[i]].data());
+            }
+
+            const size_t count = end - begin;
+            if (count <= 2u)
+                return node;
+
+            // Split Along The Centroids' Largest Extent
+            size_t axis = 0u;
+            for (size_t c = 1u; c < 3u; c++)
+                if (centroidBounds.max[c] - centroidBounds.min[c] > centroidBounds.max[axis] - centroidBounds.min[axis])
+                    axis = c;
+
+            const float axisMin    = centroidBounds.min[axis];
+            const float axisExtent = centroidBounds.max[axis] - axisMin;
+
+            size_t middle = begin;
+            if (axisExtent > 0.f) {
+                const float binScale = BIN_COUNT * (1.f - 1e-5f) / axisExtent;
+                auto GetBin = [&](const std::uint32_t primitive) {
+                    return std::min(BIN_COUNT - 1u, static_cast<size_t>((this->m_centroids[primitive][axis] - axisMin) * binScale));
+                };
+
+                // Bin The Primitives
+                struct Bin {
+                    Aabb   bounds;
+                    size_t count = 0u;
+                }; // Bin
+
+                std::array<Bin, BIN_COUNT> bins;
+                auto BinRange = [&](const size_t rangeBegin, const size_t rangeEnd, std::array<Bin, BIN_COUNT>& rangeBins) {
+                    for (size_t i = rangeBegin; i < rangeEnd; i++) {
+                        Bin& bin = rangeBins[GetBin(this->m_order[i])];
+                        bin.bounds.Grow(this->m_primitiveBounds[this->m_order[i]]);
+                        bin.count++;
+                    }
+                };
+
+                if (count >= PARALLEL_BINNING_THRESHOLD) {
+                    std::mutex binsMutex;
+                    ParallelFor(count, PARALLEL_BINNING_THRESHOLD / 4u, [&](const size_t rangeBegin, const size_t rangeEnd) {
+                        std::array<Bin, BIN_COUNT> rangeBins;
+                        BinRange(begin + rangeBegin, begin + rangeEnd, rangeBins);
+
+                        std::lock_guard<std::mutex> lock(binsMutex);
+                        for (size_t b = 0u; b < BIN_COUNT; b++) {
+                            bins[b].bounds.Grow(rangeBins[b].bounds);
+                            bins[b].count += rangeBins[b].count;
+                        }
+                    });
+                } else {
+                    BinRange(begin, end, bins);
+                }
+
+                // Sweep From Both Sides For The Cheapest Split Plane
+                std::array<float, BIN_COUNT> rightCosts;
+                Aabb rightBounds;
+                size_t rightCount = 0u;
+                for (size_t b = BIN_COUNT - 1u; b > 0u; b--) {
+                    rightBounds.Grow(bins[b].bounds);
+                    rightCount += bins[b].count;
+                    rightCosts[b] = rightBounds.GetHalfSurfaceArea() * rightCount;
+                }
+
+                float  bestCost  = FLT_MAX;
+                size_t bestSplit = 0u; // The First Bin On The Right
+                Aabb   leftBounds;
+                size_t leftCount = 0u;
+                for (size_t b = 1u; b < BIN_COUNT; b++) {
+                    leftBounds.Grow(bins[b - 1u].bounds);
+                    leftCount += bins[b - 1u].count;
+
+                    const float cost = leftBounds.GetHalfSurfaceArea() * leftCount + rightCosts[b];
+                    if (leftCount > 0u && leftCount < count && cost < bestCost) {
+                        bestCost  = cost;
+                        bestSplit = b;
+                    }
+                }
+
+                // Splitting Costs At Least One Traversal Step, Small Nodes Can Do Without
+                const float leafCost = node->bounds.GetHalfSurfaceArea() * count;
+                if (count <= MAX_LEAF_SIZE && bestCost >= leafCost)
+                    return node;
+
+                if (bestSplit > 0u) {
+                    const auto it = std::partition(this->m_order.begin() + begin, this->m_order.begin() + end,
+                        [&](const std::uint32_t primitive) { return GetBin(primitive) < bestSplit; });
+                    middle = static_cast<size_t>(std::distance(this->m_order.begin(), it));
+                }
+            } else if (count <= MAX_LEAF_SIZE) {
+                return node;
+            }
+
+            // Coincident Centroids: Split The Range In Half
+            if (middle == begin || middle == end) {
+                middle = begin + count / 2u;
+                std::nth_element(this->m_order.begin() + begin, this->m_order.begin() + middle, this->m_order.begin() + end,
+                    [&](const std::uint32_t a, const std::uint32_t b) { return this->m_centroids[a][axis] < this->m_centroids[b][axis]; });
+            }
+
+            if (count >= PARALLEL_SUBTREE_THRESHOLD) {
+                auto left = std::async(std::launch::async, [this, begin, middle]() { return this->BuildSubtree(begin, middle); });
+                node->children[1] = this->BuildSubtree(middle, end);
+                node->children[0] = left.get();
+            } else {
+                node->children[0] = this->BuildSubtree(begin, middle);
+                node->children[1] = this->BuildSubtree(middle, end);
+            }
+
+            return node;
+        }
+
+        void Flatten(const BuildNode& buildNode, std::vector<SceneBvhNode>& nodes) const {
+            const size_t nodeIndex = nodes.size();
+
+            SceneBvhNode node = {};
+            std::copy(buildNode.bounds.min, buildNode.bounds.min + 3, node.boundsMin);
+            std::copy(buildNode.bounds.max, buildNode.bounds.max + 3, node.boundsMax);
+            nodes.push_back(node);
+
+            if (!buildNode.children[0]) {
+                nodes[nodeIndex].primitiveCount = static_cast<std::uint32_t>(buildNode.end - buildNode.begin);
+                nodes[nodeIndex].index          = static_cast<std::uint32_t>(buildNode.begin);
+                return;
+            }
+
+            this->Flatten(*buildNode.children[0], nodes);
+            this->Flatten(*buildNode.children[1], nodes);
+
+            nodes[nodeIndex].primitiveCount = 0u;
+            nodes[nodeIndex].index          = static_cast<std::uint32_t>(nodes.size()); // Escape
+        }
+
+    public:
+        // Sorts 'triangles' Into Leaf Order & Returns The Flattened Nodes
+        std::vector<SceneBvhNode> Build(std::vector<SceneTriangle>& triangles) {
+            if (triangles.empty())
+                return {};
+
+            this->m_primitiveBounds.resize(triangles.size());
+            this->m_centroids.resize(triangles.size());
+            this->m_order.resize(triangles.size());
+
+            ParallelFor(triangles.size(), 1u << 14, [&](const size_t begin, const size_t end) {
+                for (size_t i = begin; i < end; i++) {
+                    const SceneTriangle& triangle = triangles[i];
+
+                    Aabb bounds;
+                    for (size_t v = 0u; v < 3u; v++) {
+                        float vertex[3];
+                        for (size_t c = 0u; c < 3u; c++)
+                            vertex[c] = triangle.v0[c] + ((v == 1u) ? triangle.edge1[c] : (v == 2u) ? triangle.edge2[c] : 0.f);
+                        bounds.Grow(vertex);
+                    }
+
+                    this->m_primitiveBounds[i] = bounds;
+                    for (size_t c = 0u; c < 3u; c++)
+                        this->m_centroids[i][c] = 0.5f * (bounds.min[c] + bounds.max[c]);
+                    this->m_order[i] = static_cast<std::uint32_t>(i);
+                }
+            });
+
+            const std::unique_ptr<BuildNode> root = this->BuildSubtree(0u, triangles.size());
+
+            std::vector<SceneBvhNode> nodes;
+            nodes.reserve(2u * triangles.size());
+            this->Flatten(*root, nodes);
+
+            std::vector<SceneTriangle> ordered(triangles.size());
+            for (size_t i = 0u; i < triangles.size(); i++)
+                ordered[i] = triangles[this->m_order[i]];
+            triangles.swap(ordered);
+
+            return nodes;
+        }
+    }; // Builder
+
+}; // namespace Bvh
+
+// Every Section Starts With Its Element Count, Padded So That The Elements Are 16-Byte Aligned
+struct SceneSectionHeader {
+    std::uint32_t count;
+    std::uint32_t padding[3];
+}; // SceneSectionHeader
+
+// The Binary Scene Format (.pscn): A Header Padded To SCENE_ALIGNMENT Bytes Followed By The Sections,
+// Each Aligned To SCENE_ALIGNMENT (The Largest minStorageBufferOffsetAlignment Vulkan Allows)
+// Everything After The Header Is Laid Out Exactly As The Shader Reads It, So It Is Uploaded With A Single Copy
+struct SceneFileHeader {
+    char          magic[4]; // "PSCN"
+    std::uint32_t version;
+    float         cameraPosition[3];
+    float         cameraTarget[3];
+    std::uint64_t sectionOffsets[SCENE_SECTION_COUNT]; // From The Start Of The File
+    std::uint64_t sectionSizes[SCENE_SECTION_COUNT];   // In Bytes, Including The Section Header
+}; // SceneFileHeader
+
+constexpr std::uint32_t SCENE_FILE_VERSION = 3u;
+constexpr size_t        SCENE_ALIGNMENT    = 256u;
+
+class Scene {
+private:
+    std::vector<std::uint8_t> m_ownedData; // Scenes Built In Code Or Parsed From Text
+
+    // Memory Mapped .pscn Files
+#ifdef _WIN32
+    HANDLE m_hFile    = INVALID_HANDLE_VALUE;
+    HANDLE m_hMapping = NULL;
+#endif
+    void*  m_pMapping    = nullptr;
+    size_t m_mappingSize = 0u;
+
+    const std::uint8_t* m_pData = nullptr; // The Whole File
+    size_t              m_size  = 0u;
+
+    float m_bvhBuildMilliseconds = 0.f; // 0 When The BVH Was Loaded Prebuilt
+
+private:
+    Scene() = default;
+
+    const SceneFileHeader& GetHeader() const noexcept { return *reinterpret_cast<const SceneFileHeader*>(this->m_pData); }
+
+    template <typename T>
+    const T* GetElements(const SceneSection section) const noexcept {
+        return reinterpret_cast<const T*>(this->m_pData + this->GetHeader().sectionOffsets[section] + sizeof(SceneSectionHeader));
+    }
+
+    // Checks That The Header Describes Sections Which Fit In The File
+    void Validate(const std::string& name) const {
+        const SceneFileHeader& header = this->GetHeader();
+
+        if (this->m_size < SCENE_ALIGNMENT || std::memcmp(header.magic, "PSCN", 4u) != 0)
+            throw std::runtime_error(name + " Is Not A Scene File");
+
+        if (header.version != SCENE_FILE_VERSION)
+            throw std::runtime_error(name + " Has Unsupported Scene Version " + std::to_string(header.version));
+
+        constexpr size_t strides[SCENE_SECTION_COUNT] = { sizeof(SceneMaterial), sizeof(SceneSphere), sizeof(ScenePlane), sizeof(SceneTriangle), sizeof(SceneBvhNode), sizeof(SceneLight) };
+
+        for (std::uint32_t section = 0u; section < SCENE_SECTION_COUNT; section++) {
+            const std::uint64_t offset = header.sectionOffsets[section];
+            const std::uint64_t size   = header.sectionSizes[section];
+
+            if (offset < SCENE_ALIGNMENT || offset % SCENE_ALIGNMENT || size < sizeof(SceneSectionHeader) || offset + size > this->m_size)
+                throw std::runtime_error(name + " Has An Invalid Section Layout");
+
+            const auto& sectionHeader = *reinterpret_cast<const SceneSectionHeader*>(this->m_pData + offset);
+            if (sizeof(SceneSectionHeader) + static_cast<std::uint64_t>(sectionHeader.count) * strides[section] > size)
+                throw std::runtime_error(name + " Has A Truncated Section");
+        }
+
+        const std::uint32_t materialCount = this->GetSectionCount(eSceneSectionMaterials);
+        for (std::uint32_t i = 0u; i < this->GetSectionCount(eSceneSectionSpheres); i++)
+            if (this->GetSpheres()[i].materialIndex >= materialCount)
+                throw std::runtime_error(name + " References A Missing Material");
+        for (std::uint32_t i = 0u; i < this->GetSectionCount(eSceneSectionPlanes); i++)
+            if (this->GetPlanes()[i].materialIndex >= materialCount)
+                throw std::runtime_error(name + " References A Missing Material");
+        for (std::uint32_t i = 0u; i < this->GetSectionCount(eSceneSectionTriangles); i++)
+            if (this->GetTriangles()[i].materialIndex >= materialCount)
+                throw std::runtime_error(name + " References A Missing Material");
+
+        // The Shaders Follow Light Indices Both Ways
+        const std::uint32_t lightCount = this->GetSectionCount(eSceneSectionLights);
+        for (std::uint32_t i = 0u; i < this->GetSectionCount(eSceneSectionSpheres); i++)
+            if (this->GetSpheres()[i].lightIndex != SCENE_NO_LIGHT && this->GetSpheres()[i].lightIndex >= lightCount)
+                throw std::runtime_error(name + " References A Missing Light");
+        for (std::uint32_t i = 0u; i < this->GetSectionCount(eSceneSectionTriangles); i++)
+            if (this->GetTriangles()[i].lightIndex != SCENE_NO_LIGHT && this->GetTriangles()[i].lightIndex >= lightCount)
+                throw std::runtime_error(name + " References A Missing Light");
+        for (std::uint32_t i = 0u; i < lightCount; i++) {
+            const SceneLight& light = this->GetLights()[i];
+
+            const bool bValid = (light.primitiveType == eSceneLightSphere)   ? (light.primitiveIndex < this->GetSectionCount(eSceneSectionSpheres)) :
+                                (light.primitiveType == eSceneLightTriangle) ? (light.primitiveIndex < this->GetSectionCount(eSceneSectionTriangles)) : false;
+            if (!bValid)
+                throw std::runtime_error(name + " Has An Invalid Light");
+        }
+
+        // A Malformed Tree Would Hang The Traversal
+        const std::uint32_t triangleCount = this->GetSectionCount(eSceneSectionTriangles);
+        const std::uint32_t nodeCount     = this->GetSectionCount(eSceneSectionBvhNodes);
+        for (std::uint32_t i = 0u; i < nodeCount; i++) {
+            const SceneBvhNode& node = this->GetBvhNodes()[i];
+
+            const bool bValid = node.primitiveCount ? (static_cast<std::uint64_t>(node.index) + node.primitiveCount <= triangleCount) : (node.index > i && node.index <= nodeCount);
+            if (!bValid)
+                throw std::runtime_error(name + " Has An Invalid BVH");
+        }
+    }
+
+    // Lists The Emissive Spheres & Triangles (After The BVH Has Reordered The Triangles) & Links Them Back To Their Lights
+    // Planes Are Infinite, So Emissive Planes Are Only Found By Following The BSDF
+    static std::vector<SceneLight> BuildLights(const std::vector<SceneMaterial>& materials, std::vector<SceneSphere>& spheres, std::vector<SceneTriangle>& triangles) {
+        std::vector<SceneLight> lights;
+        std::vector<double>     powers;
+
+        auto AddLight = [&](const SceneLightType type, const std::uint32_t index, const std::uint32_t materialIndex, const double area, std::uint32_t& lightIndex) {
+            const float* emittance = materials[materialIndex].emittance;
+            const double power     = area * (static_cast<double>(emittance[0]) + emittance[1] + emittance[2]);
+
+            lightIndex = SCENE_NO_LIGHT;
+            if (!(power > 0.0))
+                return;
+
+            lightIndex = static_cast<std::uint32_t>(lights.size());
+            lights.push_back(SceneLight{ type, index, 0.f, 0.f });
+            powers.push_back(power);
+        };
+
+        for (std::uint32_t i = 0u; i < spheres.size(); i++)
+            AddLight(eSceneLightSphere, i, spheres[i].materialIndex, 4.0 * 3.141592653589793 * spheres[i].radius * spheres[i].radius, spheres[i].lightIndex);
+
+        for (std::uint32_t i = 0u; i < triangles.size(); i++) {
+            const SceneTriangle& triangle = triangles[i];
+            const double normal[3] = {
+                static_cast<double>(triangle.edge1[1]) * triangle.edge2[2] - static_cast<double>(triangle.edge1[2]) * triangle.edge2[1],
+                static_cast<double>(triangle.edge1[2]) * triangle.edge2[0] - static_cast<double>(triangle.edge1[0]) * triangle.edge2[2],
+                static_cast<double>(triangle.edge1[0]) * triangle.edge2[1] - static_cast<double>(triangle.edge1[1]) * triangle.edge2[0]
+            };
+
+            AddLight(eSceneLightTriangle, i, triangle.materialIndex, 0.5 * std::sqrt(normal[0] * normal[0] + normal[1] * normal[1] + normal[2] * normal[2]), triangles[i].lightIndex);
+        }
+
+        const double totalPower = std::accumulate(powers.begin(), powers.end(), 0.0);
+
+        double cdf = 0.0;
+        for (size_t i = 0u; i < lights.size(); i++) {
+            cdf += powers[i];
+            lights[i].probability = static_cast<float>(powers[i] / totalPower);
+            lights[i].cdf         = (i + 1u == lights.size()) ? 1.f : static_cast<float>(cdf / totalPower);
+        }
+
+        return lights;
+    }
+
+    // Builds The BVH Over 'triangles' & Lays Out A .pscn File In Memory
+    static Scene Build(const Camera& camera, const std::vector<SceneMaterial>& materials, std::vector<SceneSphere> spheres, const std::vector<ScenePlane>& planes,
+                       std::vector<SceneTriangle> triangles) {
+        const auto buildStart = std::chrono::steady_clock::now();
+        const std::vector<SceneBvhNode> bvhNodes = Bvh::Builder().Build(triangles);
+        const float bvhBuildMilliseconds = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - buildStart).count();
+
+        const std::vector<SceneLight> lights = BuildLights(materials, spheres, triangles);
+
+        const void*  pElements[SCENE_SECTION_COUNT] = { materials.data(), spheres.data(), planes.data(), triangles.data(), bvhNodes.data(), lights.data() };
+        const size_t counts[SCENE_SECTION_COUNT]    = { materials.size(), spheres.size(), planes.size(), triangles.size(), bvhNodes.size(), lights.size() };
+        const size_t sizes[SCENE_SECTION_COUNT]     = {
+            materials.size() * sizeof(SceneMaterial), spheres.size()  * sizeof(SceneSphere), planes.size() * sizeof(ScenePlane),
+            triangles.size() * sizeof(SceneTriangle), bvhNodes.size() * sizeof(SceneBvhNode), lights.size() * sizeof(SceneLight)
+        };
+
+        SceneFileHeader header = {};
+        std::memcpy(header.magic, "PSCN", 4u);
+        header.version = SCENE_FILE_VERSION;
+        std::copy(camera.position, camera.position + 3, header.cameraPosition);
+        std::copy(camera.target,   camera.target   + 3, header.cameraTarget);
+
+        size_t offset = SCENE_ALIGNMENT;
+        for (std::uint32_t section = 0u; section < SCENE_SECTION_COUNT; section++) {
+            header.sectionOffsets[section] = offset;
+            header.sectionSizes[section]   = sizeof(SceneSectionHeader) + sizes[section];
+            offset += (header.sectionSizes[section] + SCENE_ALIGNMENT - 1u) / SCENE_ALIGNMENT * SCENE_ALIGNMENT;
+        }
+
+        Scene scene;
+        scene.m_ownedData.resize(offset, 0u);
+        std::memcpy(scene.m_ownedData.data(), &header, sizeof(header));
+
+        for (std::uint32_t section = 0u; section < SCENE_SECTION_COUNT; section++) {
+            SceneSectionHeader sectionHeader = {};
+            sectionHeader.count = static_cast<std::uint32_t>(counts[section]);
+
+            std::uint8_t* pSection = scene.m_ownedData.data() + header.sectionOffsets[section];
+            std::memcpy(pSection, &sectionHeader, sizeof(sectionHeader));
+            if (sizes[section])
+                std::memcpy(pSection + sizeof(sectionHeader), pElements[section], sizes[section]);
+        }
+
+        scene.m_pData = scene.m_ownedData.data();
+        scene.m_size  = scene.m_ownedData.size();
+
+        if (!triangles.empty())
+            scene.m_bvhBuildMilliseconds = bvhBuildMilliseconds;
+
+        return scene;
+    }
+
+    static Scene MapBinary(const std::string& filename) {
+        Scene scene;
+
+#ifdef _WIN32
+        scene.m_hFile = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+        if (scene.m_hFile == INVALID_HANDLE_VALUE)
+            throw std::runtime_error("Failed To Open Scene " + filename);
+
+        LARGE_INTEGER fileSize;
+        GetFileSizeEx(scene.m_hFile, &fileSize);
+        scene.m_mappingSize = static_cast<size_t>(fileSize.QuadPart);
+
+        scene.m_hMapping = CreateFileMappingA(scene.m_hFile, NULL, PAGE_READONLY, 0, 0, NULL);
+        scene.m_pMapping = scene.m_hMapping ? MapViewOfFile(scene.m_hMapping, FILE_MAP_READ, 0, 0, 0) : nullptr;
+#else
+        const int fd = open(filename.c_str(), O_RDONLY);
+        if (fd < 0)
+            throw std::runtime_error("Failed To Open Scene " + filename);
+
+        struct stat fileStat;
+        fstat(fd, &fileStat);
+        scene.m_mappingSize = static_cast<size_t>(fileStat.st_size);
+
+        scene.m_pMapping = (scene.m_mappingSize > 0u) ? mmap(nullptr, scene.m_mappingSize, PROT_READ, MAP_PRIVATE, fd, 0) : MAP_FAILED;
+        if (scene.m_pMapping == MAP_FAILED)
+            scene.m_pMapping = nullptr;
+
+        close(fd); // The Mapping Keeps The File Alive
+#endif
+
+        if (!scene.m_pMapping)
+            throw std::runtime_error("Failed To Map Scene " + filename);
+
+        scene.m_pData = static_cast<const std::uint8_t*>(scene.m_pMapping);
+        scene.m_size  = scene.m_mappingSize;
+
+        return scene;
+    }
+
+    // One Statement Per Line, '#' Starts A Comment:
+    //   camera   px py pz  tx ty tz
+    //   material name  r g b  er eg eb   (Diffuse Color & Emittance)
+    //   sphere   cx cy cz  radius  material
+    //   plane    px py pz  nx ny nz  material
+    //   mesh     file.obj|file.ply  material  [scale [tx ty tz]]   (Paths Are Relative To The Scene File)
+    static Scene ParseText(const std::string& filename) {
+        std::ifstream file(filename);
+        if (!file.is_open())
+            throw std::runtime_error("Failed To Open Scene " + filename);
+
+        Camera                                camera;
+        std::vector<SceneMaterial>            materials;
+        std::vector<SceneSphere>              spheres;
+        std::vector<ScenePlane>               planes;
+        std::vector<SceneTriangle>            triangles;
+        std::map<std::string, std::uint32_t>  materialIndices;
+
+        std::string line;
+        for (size_t lineNumber = 1u; std::getline(file, line); lineNumber++) {
+            std::istringstream stream(line.substr(0u, line.find('#')));
+
+            std::string keyword;
+            if (!(stream >> keyword))
+                continue;
+
+            auto Fail = [&](const std::string& reason) {
+                return std::runtime_error(filename + ":" + std::to_string(lineNumber) + ": " + reason);
+            };
+
+            auto ReadMaterialIndex = [&]() {
+                std::string name;
+                stream >> name;
+
+                const auto it = materialIndices.find(name);
+                if (it == materialIndices.end())
+                    throw Fail("Unknown Material '" + name + "'");
+
+                return it->second;
+            };
+
+            if (keyword == "camera") {
+                stream >> camera.position[0] >> camera.position[1] >> camera.position[2] >> camera.target[0] >> camera.target[1] >> camera.target[2];
+            } else if (keyword == "material") {
+                std::string   name;
+                SceneMaterial material = {};
+                stream >> name >> material.diffuseColor[0] >> material.diffuseColor[1] >> material.diffuseColor[2]
+                       >> material.emittance[0] >> material.emittance[1] >> material.emittance[2];
+
+                materialIndices[name] = static_cast<std::uint32_t>(materials.size());
+                materials.push_back(material);
+            } else if (keyword == "sphere") {
+                SceneSphere sphere = {};
+                stream >> sphere.center[0] >> sphere.center[1] >> sphere.center[2] >> sphere.radius;
+                sphere.materialIndex = ReadMaterialIndex();
+
+                spheres.push_back(sphere);
+            } else if (keyword == "plane") {
+                ScenePlane plane = {};
+                stream >> plane.point[0] >> plane.point[1] >> plane.point[2] >> plane.normal[0] >> plane.normal[1] >> plane.normal[2];
+                plane.materialIndex = ReadMaterialIndex();
+
+                const float length = std::sqrt(plane.normal[0] * plane.normal[0] + plane.normal[1] * plane.normal[1] + plane.normal[2] * plane.normal[2]);
+                if (!(length > 0.f))
+                    throw Fail("Degenerate Plane Normal");
+                for (float& n : plane.normal)
+                    n /= length;
+
+                planes.push_back(plane);
+            } else if (keyword == "mesh") {
+                std::string meshFilename;
+                stream >> meshFilename;
+
+                const std::uint32_t materialIndex = ReadMaterialIndex();
+
+                // The Transform Is Optional, But A Scale Comes With All Three Translation Components
+                std::vector<float> transform;
+                for (std::string token; stream >> token; ) {
+                    char* pEnd = nullptr;
+                    transform.push_back(std::strtof(token.c_str(), &pEnd));
+                    if (*pEnd != '\0')
+                        throw Fail("Malformed Mesh Transform '" + token + "'");
+                }
+
+                if (!transform.empty() && transform.size() != 4u)
+                    throw Fail("A Mesh Transform Is A Scale & Three Translation Components");
+
+                float scale = 1.f, translation[3] = { 0.f, 0.f, 0.f };
+                if (!transform.empty()) {
+                    scale = transform[0];
+                    std::copy(transform.begin() + 1, transform.end(), translation);
+                }
+
+                const auto meshPath = std::filesystem::path(filename).parent_path() / meshFilename;
+                const MeshLoader::Mesh mesh = MeshLoader::Load(meshPath.string());
+
+                triangles.reserve(triangles.size() + mesh.indices.size() / 3u);
+                for (size_t i = 0u; i + 2u < mesh.indices.size(); i += 3u) {
+                    float vertices[3][3];
+                    for (size_t v = 0u; v < 3u; v++)
+                        for (size_t c = 0u; c < 3u; c++)
+                            vertices[v][c] = mesh.positions[mesh.indices[i + v]][c] * scale + translation[c];
+
+                    SceneTriangle triangle = {};
+                    triangle.materialIndex = materialIndex;
+                    for (size_t c = 0u; c < 3u; c++) {
+                        triangle.v0[c]    = vertices[0][c];
+                        triangle.edge1[c] = vertices[1][c] - vertices[0][c];
+                        triangle.edge2[c] = vertices[2][c] - vertices[0][c];
+                    }
+
+                    triangles.push_back(triangle);
+                }
+            } else {
+                throw Fail("Unknown Statement '" + keyword + "'");
+            }
+
+            if (stream.fail())
+                throw Fail("Malformed '" + keyword + "' Statement");
+        }
+
+        return Build(camera, materials, spheres, planes, std::move(triangles));
+    }
+
+public:
+    Scene(Scene&& other) noexcept { *this = std::move(other); }
+
+    Scene& operator=(Scene&& other) noexcept {
+        std::swap(this->m_ownedData, other.m_ownedData);
+#ifdef _WIN32
+        std::swap(this->m_hFile, other.m_hFile);
+        std::swap(this->m_hMapping, other.m_hMapping);
+#endif
+        std::swap(this->m_pMapping, other.m_pMapping);
+        std::swap(this->m_mappingSize, other.m_mappingSize);
+        std::swap(this->m_pData, other.m_pData);
+        std::swap(this->m_size, other.m_size);
+        std::swap(this->m_bvhBuildMilliseconds, other.m_bvhBuildMilliseconds);
+
+        return *this;
+    }
+
+    Scene(const Scene&) = delete;
+    Scene& operator=(const Scene&) = delete;
+
+    ~Scene() {
+#ifdef _WIN32
+        if (this->m_pMapping) UnmapViewOfFile(this->m_pMapping);
+        if (this->m_hMapping) CloseHandle(this->m_hMapping);
+        if (this->m_hFile != INVALID_HANDLE_VALUE) CloseHandle(this->m_hFile);
+#else
+        if (this->m_pMapping) munmap(this->m_pMapping, this->m_mappingSize);
+#endif
+    }
+
+    // The Scene That Used To Be Compiled Into The Shader
+    static Scene CreateDefault() {
+        const std::vector<SceneMaterial> materials = {
+            SceneMaterial{ { 1.f, 0.f, 0.f, 0.f }, { 0.f, 0.f, 0.f, 0.f } },
+            SceneMaterial{ { 0.f, 0.f, 0.f, 0.f }, { 1.f, 1.f, 1.f, 0.f } }
+        };
+
+        const std::vector<SceneSphere> spheres = {
+            SceneSphere{ { 0.00f, 0.f, 2.f }, 0.5f, 0u, SCENE_NO_LIGHT, { 0u, 0u } },
+            SceneSphere{ { 1.25f, 0.f, 1.f }, 0.5f, 1u, SCENE_NO_LIGHT, { 0u, 0u } }
+        };
+
+        return Build(Camera(), materials, spheres, {}, {});
+    }
+
+    // .pscn Files Are Memory Mapped, Anything Else Is Parsed As Text
+    static Scene Load(const std::string& filename) {
+        Scene scene = (std::filesystem::path(filename).extension() == ".pscn") ? MapBinary(filename) : ParseText(filename);
+        scene.Validate(filename);
+
+        return scene;
+    }
+
+    // Writes The Scene In The Binary Format
+    void Save(const std::string& filename) const {
+        std::ofstream file(filename, std::ios::binary | std::ios::trunc);
+        if (!file.write(reinterpret_cast<const char*>(this->m_pData), this->m_size))
+            throw std::runtime_error("Failed To Write Scene " + filename);
+    }
+
+    Camera GetCamera() const noexcept {
+        Camera camera;
+        std::copy(this->GetHeader().cameraPosition, this->GetHeader().cameraPosition + 3, camera.position);
+        std::copy(this->GetHeader().cameraTarget,   this->GetHeader().cameraTarget   + 3, camera.target);
+
+        return camera;
+    }
+
+    // The Part Of The File Uploaded To The GPU, Section Offsets Are Relative To It
+    const std::uint8_t* GetGpuData()     const noexcept { return this->m_pData + SCENE_ALIGNMENT; }
+    size_t              GetGpuDataSize() const noexcept { return this->m_size - SCENE_ALIGNMENT; }
+
+    std::uint64_t GetSectionOffset(const SceneSection section) const noexcept { return this->GetHeader().sectionOffsets[section] - SCENE_ALIGNMENT; }
+    std::uint64_t GetSectionSize(const SceneSection section)   const noexcept { return this->GetHeader().sectionSizes[section]; }
+    std::uint32_t GetSectionCount(const SceneSection section)  const noexcept { return reinterpret_cast<const SceneSectionHeader*>(this->m_pData + this->GetHeader().sectionOffsets[section])->count; }
+
+    const SceneMaterial* GetMaterials() const noexcept { return this->GetElements<SceneMaterial>(eSceneSectionMaterials); }
+    const SceneSphere*   GetSpheres()   const noexcept { return this->GetElements<SceneSphere>(eSceneSectionSpheres); }
+    const ScenePlane*    GetPlanes()    const noexcept { return this->GetElements<ScenePlane>(eSceneSectionPlanes); }
+    const SceneTriangle* GetTriangles() const noexcept { return this->GetElements<SceneTriangle>(eSceneSectionTriangles); }
+    const SceneBvhNode*  GetBvhNodes()  const noexcept { return this->GetElements<SceneBvhNode>(eSceneSectionBvhNodes); }
+    const SceneLight*    GetLights()    const noexcept { return this->GetElements<SceneLight>(eSceneSectionLights); }
+
+    float GetBvhBuildMilliseconds() const noexcept { return this->m_bvhBuildMilliseconds; }
+}; // Scene
+
+enum class Backend {
+    eAuto, // The GPU, Or The CPU When There Is No Compatible GPU
+    eGPU,
+    eCPU
+}; // Backend
+
+// How The GPU Traces A Pass
+enum class GpuKernel {
+    eMegakernel, // shader.glsl: One Thread Follows Its Pixel's Paths Through Every Bounce
+    eWavefront   // wavefront_*.glsl: One Dispatch Per Stage & Bounce Over Queues Of Live Paths
+}; // GpuKernel
+
+// Where A Sample's Camera & First Bounce Dimensions Come From (The Values Of common.glsl's SAMPLE_SEQUENCE_*)
+enum class SampleSequence : std::uint32_t {
+    ePCG       = 0u, // Independent Random Numbers From The Sample's PCG Stream
+    eSobolOwen = 1u  // Owen-Scrambled Sobol Points, Stratified Across A Pixel's Samples
+}; // SampleSequence
+
+// The AOV Images --aov Writes Next To Each Frame
+enum AovExport : std::uint32_t {
+    eAovExportAlbedo = 1u << 0u,
+    eAovExportNormal = 1u << 1u,
+    eAovExportDepth  = 1u << 2u
+}; // AovExport
+
+struct CommandLineArguments {
+    std::uint32_t surfaceWidth;
+    std::uint32_t surfaceHeight;
+    std::uint32_t samplesPerPixel; // The Total Number Of Path Simulations Per Pixel
+    std::uint32_t maxBounces;      // The Maximum Number Of Iterations For Each Sample
+
+    // Progressive Rendering
+    std::uint32_t tileSize;        // The Side Length Of A Square Tile In Pixels
+    std::uint32_t samplesPerPass;  // The Number Of Samples Per Pixel Taken By Each Submit
+    std::uint32_t maxSubmitsInFlight;
+    float         timeBudget;      // In Seconds, 0 Means Unlimited
+
+    // Adaptive Sampling: Once A Pixel Has 'adaptiveMinSamples', It Stops Sampling When Its Relative Error Drops Below The Threshold
+    float         adaptiveThreshold;  // 0 Disables Adaptive Sampling, 'samplesPerPixel' Is The Maximum Otherwise
+    std::uint32_t adaptiveMinSamples;
+
+    std::string   cacheDirectory;  // Where Compiled Shaders & The Pipeline Cache Are Stored
+
+    // Checkpoints & Distributed Rendering: Samples [sampleOffset, sampleOffset + samplesPerPixel) Are Traced, So Renders Of
+    // Disjoint Ranges (e.g. On Different Machines) Merge Into The Render Of Their Union
+    std::uint32_t            sampleOffset;       // The Index Of The First Sample, Which Seeds Its Random Numbers
+    std::string              checkpointFilename; // The Accumulation File Written During The Render & Resumed From, Empty Not To
+    float                    checkpointInterval; // In Seconds
+    std::vector<std::string> mergeFilenames;     // The Accumulation Files Of ./PolarTracer merge
+
+    // Output
+    ImageFormat   outputFormat;
+    ToneMapping   toneMapping;
+    std::string   outputPrefix;    // Empty For The Default Timestamped Name
+    bool          bDenoise;        // Filters Each Frame Before It Is Saved
+    std::uint32_t aovExports;      // AovExport Bits
+    bool          bAovs;           // Whether The Tracers Record AOVs, For The Denoiser Or For Export
+    bool          bOutOfCore;      // Renders A Frame Region By Region & Streams Its Rows To The Output, So It Never Has To Fit In Memory
+
+    // GPU Bandwidth: How The Accumulation Is Stored & What Is Read Back
+    AccumulationFormat accumulationFormat;
+    GpuResolve         gpuResolve;
+
+    // Batch / Animation
+    std::uint32_t frameCount;
+    std::string   cameraPathFilename;
+
+    std::string   profileFilename; // Where The JSON Report Is Written, Empty When Not Profiling
+
+    Backend        backend;
+    GpuKernel      gpuKernel;
+    SampleSequence sampleSequence;
+
+    // Multi-Device: The Listed Physical Devices, Or Every Hardware Device When Empty (Software Ones Too With 'all')
+    std::vector<std::uint32_t> deviceIndices;
+    bool                       bAllDevices;
+
+    // Benchmarks (./PolarTracer bench <name> ...)
+    std::string    benchmark;                // Empty When Rendering
+    std::uint32_t  referenceSamplesPerPixel; // The Sample Count Of The Converged Image Errors Are Measured Against
+    std::string    suiteCasesFilename;       // bench suite: One Job Object Per Line,
+    std::string    suiteReferenceDirectory;  // The Images Each Case Is Compared Against,
+    std::string    suiteReportFilename;      // Where The Results Are Written (JSON Lines), Empty Not To
+    std::string    suiteBaselineFilename;    // A Previous Report Samples/s Are Compared Against, Empty Not To
+    bool           bUpdateReferences;        // Whether The Rendered Images Replace The References
+    double         minPsnr;                  // The Lowest PSNR (dB) Against The Reference That Passes,
+    double         maxSlowdown;              // & The Largest Relative Drop In Samples/s Against The Baseline
+
+    // Render Server (./PolarTracer serve ...): The Other Options Are The Defaults Of Every Job
+    std::string    serverSocket; // The Unix Domain Socket Jobs Are Read From, Empty For stdin
+
+    // Scene
+    std::string   sceneFilename;       // Empty For The Built-In Scene
+    std::string   exportSceneFilename; // Where To Write The Scene As .pscn, Empty Not To
+}; // CommandLineArguments
+
+CommandLineArguments ParseCommandLineArguments(int argc, char** argv) noexcept {
+    CommandLineArguments result;
+
+    auto ExtractCommandLineValueForOption = [argc, argv](const char* option) {
+        for (size_t i = 1u; i < argc; ++i)
+            if (std::strcmp(argv[i], option) == 0)
+                return argv[i + 1];
+
+        throw std::runtime_error("Missing Command Line Argument !");
+    };
+
+    auto ExtractOptionalCommandLineValueForOption = [argc, argv](const char* option, const char* defaultValue) {
+        for (int i = 1; i + 1 < argc; ++i)
+            if (std::strcmp(argv[i], option) == 0)
+                return static_cast<const char*>(argv[i + 1]);
+
+        return defaultValue;
+    };
+
+    // The Option Parsers Fall Back To Their Default For Unknown Names, A Typo Stops Here Instead Of Silently Rendering Something Else
+    auto ExtractCommandLineNameForOption = [&](const char* option, const std::initializer_list<const char*> names) {
+        const char* pValue   = ExtractOptionalCommandLineValueForOption(option, *names.begin());
+        std::string accepted;
+        for (const char* pName : names) {
+            if (std::strcmp(pValue, pName) == 0)
+                return pValue;
+
+            accepted += (accepted.empty() ? "" : ", ") + std::string(pName);
+        }
+
+        std::printf("Fatal Error %s Must Be One Of %s, Not %s\n", option, accepted.c_str(), pValue);
+        std::exit(EXIT_FAILURE);
+    };
+
+    // ./PolarTracer merge <file>... Takes The Size From Its Inputs, Every Other Argument Is An Option & Its Value
+    const bool bMerge = argc > 1 && std::strcmp(argv[1], "merge") == 0;
+    if (bMerge)
+        for (int i = 2; i < argc; i += (argv[i][0] == '-') ? 2 : 1)
+            if (argv[i][0] != '-')
+                result.mergeFilenames.push_back(argv[i]);
+
+    // ./PolarTracer serve Takes The Size From Each Job Unless It Is Given Here, bench suite From Each Case
+    const bool bSuite        = argc > 2 && std::strcmp(argv[1], "bench") == 0 && std::strcmp(argv[2], "suite") == 0;
+    const bool bOptionalSize = bMerge || bSuite || (argc > 1 && std::strcmp(argv[1], "serve") == 0);
+
+    result.surfaceWidth  = static_cast<std::uint32_t>(std::strtoul(bOptionalSize ? ExtractOptionalCommandLineValueForOption("-w", "0") : ExtractCommandLineValueForOption("-w"), nullptr, 10));
+    result.surfaceHeight = static_cast<std::uint32_t>(std::strtoul(bOptionalSize ? ExtractOptionalCommandLineValueForOption("-h", "0") : ExtractCommandLineValueForOption("-h"), nullptr, 10));
+
+    result.samplesPerPixel = std::max(1, std::atoi(ExtractOptionalCommandLineValueForOption("--spp", "100")));
+    result.maxBounces      = std::max(1, std::atoi(ExtractOptionalCommandLineValueForOption("--bounces", "10")));
+
+    result.tileSize           = std::max(1, std::atoi(ExtractOptionalCommandLineValueForOption("--tile", "256")));
+    result.samplesPerPass     = std::max(1, std::atoi(ExtractOptionalCommandLineValueForOption("--spp-per-pass", "4")));
+    result.maxSubmitsInFlight = std::max(1, std::atoi(ExtractOptionalCommandLineValueForOption("--in-flight", "3")));
+    result.timeBudget         = std::max(0.f, static_cast<float>(std::atof(ExtractOptionalCommandLineValueForOption("--time-budget", "0"))));
+
+    result.adaptiveThreshold  = std::max(0.f, static_cast<float>(std::atof(ExtractOptionalCommandLineValueForOption("--adaptive", "0"))));
+    result.adaptiveMinSamples = std::max(2, std::atoi(ExtractOptionalCommandLineValueForOption("--min-spp", "16"))); // The Variance Needs Two Samples
+
+    result.cacheDirectory = ExtractOptionalCommandLineValueForOption("--cache-dir", ".polar-cache");
+
+    result.sampleOffset       = static_cast<std::uint32_t>(std::max(0, std::atoi(ExtractOptionalCommandLineValueForOption("--sample-offset", "0"))));
+    result.checkpointFilename = ExtractOptionalCommandLineValueForOption("--checkpoint", "");
+    result.checkpointInterval = std::max(1.f, static_cast<float>(std::atof(ExtractOptionalCommandLineValueForOption("--checkpoint-interval", "60"))));
+
+    result.outputFormat = ParseImageFormat(ExtractOptionalCommandLineValueForOption("--format", "png"));
+    result.toneMapping  = ParseToneMapping(ExtractOptionalCommandLineValueForOption("--tonemap", "linear"));
+
+    result.outputPrefix       = ExtractOptionalCommandLineValueForOption("--output", "");
+
+    result.bDenoise = std::strcmp(ExtractOptionalCommandLineValueForOption("--denoise", "none"), "atrous") == 0;
+
+    const std::string aovExports = ExtractOptionalCommandLineValueForOption("--aov", "");
+    const bool        bAllAovs   = aovExports == "all";
+    result.aovExports = ((bAllAovs || aovExports.find("albedo") != std::string::npos) ? eAovExportAlbedo : 0u) |
+                        ((bAllAovs || aovExports.find("normal") != std::string::npos) ? eAovExportNormal : 0u) |
+                        ((bAllAovs || aovExports.find("depth")  != std::string::npos) ? eAovExportDepth  : 0u);
+    result.bAovs = result.bDenoise || result.aovExports != 0u;
+
+    // The Denoiser's Filter & The Depth AOV's Normalization Need The Whole Frame, Which Is Never Held Out Of Core
+    result.bOutOfCore = std::strcmp(ExtractOptionalCommandLineValueForOption("--out-of-core", "off"), "on") == 0;
+    if (result.bOutOfCore && result.bAovs) {
+        std::printf("--denoise & --aov Are Ignored With --out-of-core\n");
+        result.bDenoise   = false;
+        result.aovExports = 0u;
+        result.bAovs      = false;
+    }
+
+    // Resolved On The GPU, The Frame Leaves Its Device As 32 Bits Per Pixel: Nothing Is Left To Denoise, Export Or Checkpoint
+    result.accumulationFormat = ParseAccumulationFormat(ExtractCommandLineNameForOption("--accumulation", { "rgba32f", "rgba16f" }));
+    result.gpuResolve         = ParseGpuResolve(ExtractCommandLineNameForOption("--resolve", { "host", "rgba8", "rgb9e5" }));
+    if (result.gpuResolve != GpuResolve::eHost && (result.bAovs || !result.checkpointFilename.empty())) {
+        std::printf("--resolve Is Ignored With --denoise, --aov & --checkpoint\n");
+        result.gpuResolve = GpuResolve::eHost;
+    }
+
+    result.frameCount         = std::max(1, std::atoi(ExtractOptionalCommandLineValueForOption("--frames", "1")));
+    result.cameraPathFilename = ExtractOptionalCommandLineValueForOption("--camera-path", "");
+
+    result.profileFilename = ExtractOptionalCommandLineValueForOption("--profile", "");
+
+    const std::string backend = ExtractOptionalCommandLineValueForOption("--backend", "auto");
+    result.backend = (backend == "cpu") ? Backend::eCPU : (backend == "gpu") ? Backend::eGPU : Backend::eAuto;
+
+    const std::string gpuKernel = ExtractOptionalCommandLineValueForOption("--kernel", "megakernel");
+    result.gpuKernel = (gpuKernel == "wavefront") ? GpuKernel::eWavefront : GpuKernel::eMegakernel;
+
+    const std::string sampleSequence = ExtractOptionalCommandLineValueForOption("--sampler", "pcg");
+    result.sampleSequence = (sampleSequence == "sobol") ? SampleSequence::eSobolOwen : SampleSequence::ePCG;
+
+    const std::string devices = ExtractOptionalCommandLineValueForOption("--devices", "");
+    result.bAllDevices = devices == "all";
+    if (!result.bAllDevices) {
+        std::stringstream deviceList(devices);
+        for (std::string deviceIndex; std::getline(deviceList, deviceIndex, ',');)
+            if (!deviceIndex.empty())
+                result.deviceIndices.push_back(static_cast<std::uint32_t>(std::atoi(deviceIndex.c_str())));
+    }
+
+    result.benchmark                = (argc > 2 && std::strcmp(argv[1], "bench") == 0) ? argv[2] : "";
+    result.referenceSamplesPerPixel = std::max(1, std::atoi(ExtractOptionalCommandLineValueForOption("--reference-spp", "1024")));
+    result.suiteCasesFilename       = ExtractOptionalCommandLineValueForOption("--cases", "bench/cases.jsonl");
+    result.suiteReferenceDirectory  = ExtractOptionalCommandLineValueForOption("--references", "bench/references");
+    result.suiteReportFilename      = ExtractOptionalCommandLineValueForOption("--report", "");
+    result.suiteBaselineFilename    = ExtractOptionalCommandLineValueForOption("--baseline", "");
+    result.bUpdateReferences        = std::strcmp(ExtractOptionalCommandLineValueForOption("--update-references", "off"), "on") == 0;
+    result.minPsnr                  = std::atof(ExtractOptionalCommandLineValueForOption("--min-psnr", "40"));
+    result.maxSlowdown              = std::max(0.0, std::atof(ExtractOptionalCommandLineValueForOption("--max-slowdown", "0.1")));
+
+    result.serverSocket = ExtractOptionalCommandLineValueForOption("--socket", "");
+
+    result.sceneFilename       = ExtractOptionalCommandLineValueForOption("--scene", "");
+    result.exportSceneFilename = ExtractOptionalCommandLineValueForOption("--export-scene", "");
+
+    return result;
+}
+
+// Batch Outputs Are Indexed By Frame So That Names Never Collide
+std::string GetFrameOutputFilename(const CommandLineArguments& commandLineArguments, const std::uint32_t frameIndex) {
+    if (commandLineArguments.frameCount == 1u)
+        return commandLineArguments.outputPrefix.empty() ? GenerateOutputFilename() : commandLineArguments.outputPrefix;
+
+    char suffix[16] = { 0 };
+    std::snprintf(suffix, sizeof(suffix), "-%05u", frameIndex);
+
+    return (commandLineArguments.outputPrefix.empty() ? std::string("frame") : commandLineArguments.outputPrefix) + suffix;
+}
+
+// Thrown When Vulkan Has No Device To Run On, Lets --backend auto Fall Back To The CPU
+struct NoCompatibleDeviceError : public std::runtime_error {
+    explicit NoCompatibleDeviceError(const std::string& message) : std::runtime_error(message) { }
+}; // NoCompatibleDeviceError
+
+void InitOSApis() {
+#ifdef _WIN32
+
+    if (CoInitialize(NULL) != S_OK)
+        THROW_FATAL_ERROR("[COM] Failed To Init COM");
+
+#endif // _WIN32
+}
+
+void UninitOSApis() {
+#ifdef _WIN32
+
+    CoUninitialize();
+
+#endif // _WIN32
+}
+
+// Escapes A String For A JSON String Literal, Dropping Control Characters
+std::string EscapeJSON(const std::string& str) {
+    std::string result;
+    for (const char c : str) {
+        if (c == '"' || c == '\\')
+            result += '\\';
+        if (static_cast<unsigned char>(c) >= 0x20u)
+            result += c;
+    }
+
+    return result;
+}
+
+// Host Time Spans, Aggregated Waits & GPU Dispatch Timings Gathered With --profile, Written Out As A JSON Report
+class Profiler {
+public:
+    struct Span {
+        std::string   name;
+        std::uint32_t threadIndex; // 0 Is The Thread That Created The Profiler
+        double        beginMs;     // Relative To The Profiler's Creation
+        double        endMs;
+    }; // Span
+
+    // Stages Hit Too Often To Record Individually (e.g. Fence Waits)
+    struct Total {
+        std::uint64_t count   = 0u;
+        double        totalMs = 0.0;
+    }; // Total
+
+    // Work Done By The Run, Feeding The Derived Metrics
+    struct Counters {
+        std::uint64_t samples       = 0u;  // Pixel Samples, Each Traces One Camera Path
+        std::uint64_t rays          = 0u;  // Rays Cast Including Bounces, Counted By The Shader
+        double        renderSeconds = 0.0; // Wall Time Of The Render Loop
+    }; // Counters
+
+private:
+    bool m_bEnabled;
+
+    std::chrono::steady_clock::time_point m_start;
+
+    mutable std::mutex           m_mutex;
+    std::vector<Span>            m_spans;
+    std::vector<std::thread::id> m_threads;
+    std::map<std::string, Total> m_totals;
+
+    std::uint64_t m_gpuDispatchCount = 0u;
+    double        m_gpuDispatchMs    = 0.0;
+
+private:
+    double GetElapsedMs() const noexcept {
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - this->m_start).count();
+    }
+
+public:
+    explicit Profiler(const bool bEnabled) noexcept
+        : m_bEnabled(bEnabled), m_start(std::chrono::steady_clock::now())
+    {
+        this->m_threads.push_back(std::this_thread::get_id());
+    }
+
+    inline bool IsEnabled() const noexcept { return this->m_bEnabled; }
+
+    // Returns A Handle To Pass To EndSpan, Thread Safe
+    size_t BeginSpan(const std::string& name) {
+        if (!this->m_bEnabled)
+            return SIZE_MAX;
+
+        const double beginMs = this->GetElapsedMs();
+
+        std::lock_guard<std::mutex> lock(this->m_mutex);
+
+        const auto thread = std::find(this->m_threads.begin(), this->m_threads.end(), std::this_thread::get_id());
+        const std::uint32_t threadIndex = static_cast<std::uint32_t>(std::distance(this->m_threads.begin(), thread));
+        if (thread == this->m_threads.end())
+            this->m_threads.push_back(std::this_thread::get_id());
+
+        this->m_spans.push_back(Span{ name, threadIndex, beginMs, beginMs });
+
+        return this->m_spans.size() - 1u;
+    }
+
+    void EndSpan(const size_t span) {
+        if (span == SIZE_MAX)
+            return;
+
+        const double endMs = this->GetElapsedMs();
+
+        std::lock_guard<std::mutex> lock(this->m_mutex);
+        this->m_spans[span].endMs = endMs;
+    }
+
+    void AddToTotal(const std::string& name, const std::chrono::steady_clock::time_point& begin) {
+        if (!this->m_bEnabled)
+            return;
+
+        const double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - begin).count();
+
+        std::lock_guard<std::mutex> lock(this->m_mutex);
+        Total& total = this->m_totals[name];
+        total.count++;
+        total.totalMs += ms;
+    }
+
+    void AddGpuDispatch(const double ms) noexcept {
+        this->m_gpuDispatchCount++;
+        this->m_gpuDispatchMs += ms;
+    }
+
+    void WriteReport(const std::string& filename, const std::string& deviceName, const Counters& counters) const {
+        std::lock_guard<std::mutex> lock(this->m_mutex);
+
+        std::ofstream file(filename, std::ios::trunc);
+        if (!file.is_open())
+            throw std::runtime_error("Failed To Write Profile Report " + filename);
+
+        // Rates Over GPU Time Exclude Host Overheads, Rates Over Wall Time Include Them
+        const double gpuSeconds = this->m_gpuDispatchMs / 1000.0;
+        auto Rate = [](const std::uint64_t count, const double seconds) { return (seconds > 0.0) ? (count / seconds) : 0.0; };
+
+        file << "{\n";
+        file << "  \"device\": \"" << EscapeJSON(deviceName) << "\",\n";
+        file << "  \"spans\": [\n";
+        for (size_t i = 0u; i < this->m_spans.size(); i++) {
+            const Span& span = this->m_spans[i];
+            file << "    { \"name\": \"" << EscapeJSON(span.name) << "\", \"thread\": " << span.threadIndex
+                 << ", \"beginMs\": " << span.beginMs << ", \"durationMs\": " << (span.endMs - span.beginMs) << " }"
+                 << ((i + 1u < this->m_spans.size()) ? ",\n" : "\n");
+        }
+        file << "  ],\n";
+        file << "  \"totals\": {\n";
+        for (auto it = this->m_totals.begin(); it != this->m_totals.end(); ++it) {
+            file << "    \"" << EscapeJSON(it->first) << "\": { \"count\": " << it->second.count << ", \"totalMs\": " << it->second.totalMs << " }"
+                 << ((std::next(it) != this->m_totals.end()) ? ",\n" : "\n");
+        }
+        file << "  },\n";
+        file << "  \"gpu\": { \"dispatchCount\": " << this->m_gpuDispatchCount << ", \"dispatchMs\": " << this->m_gpuDispatchMs << " },\n";
+        file << "  \"metrics\": {\n";
+        file << "    \"samples\": " << counters.samples << ",\n";
+        file << "    \"paths\": " << counters.samples << ",\n";
+        file << "    \"rays\": " << counters.rays << ",\n";
+        file << "    \"renderSeconds\": " << counters.renderSeconds << ",\n";
+        file << "    \"samplesPerSecond\": " << Rate(counters.samples, counters.renderSeconds) << ",\n";
+        file << "    \"pathsPerSecond\": " << Rate(counters.samples, counters.renderSeconds) << ",\n";
+        file << "    \"raysPerSecond\": " << Rate(counters.rays, counters.renderSeconds) << ",\n";
+        file << "    \"gpuPathsPerSecond\": " << Rate(counters.samples, gpuSeconds) << ",\n";
+        file << "    \"gpuRaysPerSecond\": " << Rate(counters.rays, gpuSeconds) << "\n";
+        file << "  }\n";
+        file << "}\n";
+    }
+}; // Profiler
+
+// Records The Enclosing Scope As A Span
+class ProfileScope {
+private:
+    Profiler& m_profiler;
+    size_t    m_span;
+
+public:
+    ProfileScope(Profiler& profiler, const std::string& name)
+        : m_profiler(profiler), m_span(profiler.BeginSpan(name))
+    { }
+
+    ~ProfileScope() { this->m_profiler.EndSpan(this->m_span); }
+}; // ProfileScope
+
+// Denoises, Tone Maps & Saves A Frame's Accumulation Buffer, Then Its AOV Images As <filename>-albedo, -normal & -depth
+// 'pAovs' Holds Two Entries Per Pixel (Albedo & Depth, Normal) Summed Like The Accumulation, It's Only Read With commandLineArguments.bAovs
+void SaveFrame(const CommandLineArguments& commandLineArguments, const Colorf32* pAccumulation, const Colorf32* pAovs,
+               const std::string& filename, const std::uint32_t frameIndex, Profiler& profiler) {
+    const std::uint32_t width      = commandLineArguments.surfaceWidth;
+    const std::uint32_t height     = commandLineArguments.surfaceHeight;
+    const size_t        pixelCount = static_cast<size_t>(width) * height;
+
+    Image image(width, height);
+
+    std::vector<Colorf32> denoised;
+    if (commandLineArguments.bDenoise) {
+        const ProfileScope profileScope(profiler, "Denoise Frame " + std::to_string(frameIndex));
+
+        denoised.resize(pixelCount);
+        Denoiser::Denoise(pAccumulation, pAovs, denoised.data(), width, height);
+    }
+
+    {
+        const ProfileScope profileScope(profiler, "Resolve Frame " + std::to_string(frameIndex));
+        ResolveAccumulation(commandLineArguments.bDenoise ? denoised.data() : pAccumulation, image.GetBufferPtr(), image.GetPixelCount(), commandLineArguments.toneMapping);
+    }
+
+    {
+        const ProfileScope profileScope(profiler, "Save Frame " + std::to_string(frameIndex));
+        image.Save(filename, commandLineArguments.outputFormat);
+    }
+
+    if (commandLineArguments.aovExports == 0u)
+        return;
+
+    const ProfileScope profileScope(profiler, "Save AOVs " + std::to_string(frameIndex));
+
+    // Each AOV Is Turned Into Normalized Colors (.a = 1) & Written Without Tone Mapping, Except For The Albedo
+    std::vector<Colorf32> aovColors(pixelCount);
+    auto SaveAov = [&](const char* pSuffix, const ToneMapping toneMapping) {
+        ResolveAccumulation(aovColors.data(), image.GetBufferPtr(), image.GetPixelCount(), toneMapping);
+        image.Save(filename + "-" + pSuffix, commandLineArguments.outputFormat);
+    };
+
+    if (commandLineArguments.aovExports & eAovExportAlbedo) {
+        for (size_t i = 0u; i < pixelCount; i++)
+            aovColors[i] = Colorf32{ pAovs[2u * i].r, pAovs[2u * i].g, pAovs[2u * i].b, pAccumulation[i].a };
+        SaveAov("albedo", commandLineArguments.toneMapping);
+    }
+
+    // Mapped From [-1, 1] To [0, 1]
+    if (commandLineArguments.aovExports & eAovExportNormal) {
+        for (size_t i = 0u; i < pixelCount; i++) {
+            const Colorf32& normal = pAovs[2u * i + 1u];
+            const float     length = std::sqrt(normal.r * normal.r + normal.g * normal.g + normal.b * normal.b);
+            const float     scale  = (length > 0.f) ? (0.5f / length) : 0.f;
+            aovColors[i] = Colorf32{ normal.r * scale + 0.5f, normal.g * scale + 0.5f, normal.b * scale + 0.5f, 1.f };
+        }
+        SaveAov("normal", ToneMapping::eLinear);
+    }
+
+    // Scaled By The Farthest Hit, Misses Are Black
+    if (commandLineArguments.aovExports & eAovExportDepth) {
+        float maxDepth = 0.f;
+        for (size_t i = 0u; i < pixelCount; i++) {
+            const float depth = (pAccumulation[i].a > 0.f) ? (pAovs[2u * i].a / pAccumulation[i].a) : 0.f;
+            aovColors[i] = Colorf32{ depth, depth, depth, 1.f };
+            maxDepth     = std::max(maxDepth, depth);
+        }
+
+        const float scale = 1.f / std::max(maxDepth, 1e-6f);
+        for (Colorf32& color : aovColors)
+            color = Colorf32{ color.r * scale, color.g * scale, color.b * scale, 1.f };
+        SaveAov("depth", ToneMapping::eLinear);
+    }
+}
+
+// A Rectangle Of A Frame Rendered Into One Set Of Buffers, Which Hold Its Pixels Row By Row
+// The Whole Frame, Except Out Of Core Where Each Band (CPU) Or Tile (GPU) Of The Frame Is A Region Of Its Own
+struct FrameRegion {
+    std::uint32_t offsetX = 0u, offsetY = 0u;
+    std::uint32_t width   = 0u, height  = 0u;
+
+    inline size_t GetPixelCount() const noexcept { return static_cast<size_t>(width) * height; }
+
+    // Where One Of The Region's Pixels Is In Its Buffers
+    inline size_t GetIndex(const std::uint32_t x, const std::uint32_t y) const noexcept { return static_cast<size_t>(y - offsetY) * width + (x - offsetX); }
+}; // FrameRegion
+
+// Saves Frames Rendered Out Of Core: Resolved Regions Are Gathered Into A Band Of Rows As Tall As They Are, Which Is Written As
+// Soon As Its Last Region Arrives. The Regions Must Arrive In Row-Major Order, So Only One Band Of 8-Bit Pixels Is Ever Held
+class FrameStreamer {
+private:
+    const std::uint32_t m_width;
+    const std::uint32_t m_height;
+    const ImageFormat   m_format;
+
+    std::vector<Coloru8>       m_band;   // Only Needed When The Regions Are Narrower Than The Frame
+    std::optional<ImageWriter> m_writer; // The Frame Being Written
+
+public:
+    FrameStreamer(const std::uint32_t width, const std::uint32_t height, const ImageFormat format) noexcept
+        : m_width(width), m_height(height), m_format(format) { }
+
+    // Adds The Next Region's Resolved Pixels, The Frame's First Region Creates 'filename' & Its Last One Completes It
+    void AddRegion(const std::string& filename, const FrameRegion& region, const Coloru8* pPixels) {
+        if (region.offsetX == 0u && region.offsetY == 0u)
+            this->m_writer.emplace(filename, this->m_format, this->m_width, this->m_height);
+
+        if (region.width == this->m_width) {
+            this->m_writer->WriteRows(pPixels, region.height);
+        } else {
+            this->m_band.resize(std::max(this->m_band.size(), static_cast<size_t>(this->m_width) * region.height));
+            for (std::uint32_t y = 0u; y < region.height; y++)
+                std::memcpy(this->m_band.data() + static_cast<size_t>(y) * this->m_width + region.offsetX, pPixels + static_cast<size_t>(y) * region.width, region.width * sizeof(Coloru8));
+
+            if (region.offsetX + region.width == this->m_width)
+                this->m_writer->WriteRows(this->m_band.data(), region.height);
+        }
+
+        if (region.offsetX + region.width == this->m_width && region.offsetY + region.height == this->m_height) {
+            this->m_writer->Finish();
+            this->m_writer.reset();
+        }
+    }
+}; // FrameStreamer
+
+// 64-bit FNV-1a, Chainable Through 'hash'
+std::uint64_t HashBytes(const void* pData, const size_t size, std::uint64_t hash = 14695981039346656037ull) noexcept {
+    const std::uint8_t* pBytes = reinterpret_cast<const std::uint8_t*>(pData);
+
+    for (size_t i = 0u; i < size; i++) {
+        hash ^= pBytes[i];
+        hash *= 1099511628211ull;
+    }
+
+    return hash;
+}
+
+// The Accumulation File Format (.pacc): A Header Padded To ACCUMULATION_FILE_ALIGNMENT Bytes Followed By The Accumulation
+// (Summed rgb & The Sample Count In .a) &, With AOVs, Their Two Entries Per Pixel, Exactly As The Tracers Accumulate Them
+// Sums Of Disjoint Sample Ranges Add Up To The Sum Of Their Union, Which Is How Checkpoints Resume & merge Combines Renders
+struct AccumulationFileHeader {
+    char          magic[4]; // "PACC"
+    std::uint32_t version;
+    std::uint32_t width;
+    std::uint32_t height;
+    std::uint32_t frameIndex;
+    std::uint32_t bAovs;
+    std::uint32_t sampleSequence; // Only Renders With The Same Sampler & Bounces Are Merged
+    std::uint32_t maxBounces;
+    std::uint64_t sceneHash;       // Of The Scene & Camera (See HashSceneAndCamera), Which Must Match Too
+    std::uint64_t sampleBegin;     // The Lowest Sample Index Summed In The File,
+    std::uint64_t sampleEnd;       // & One Past The Highest
+    std::uint64_t samplesPerPixel; // sampleEnd - sampleBegin
+}; // AccumulationFileHeader
+
+constexpr std::uint32_t ACCUMULATION_FILE_VERSION   = 2u;
+constexpr size_t        ACCUMULATION_FILE_ALIGNMENT = 256u;
+
+static_assert(sizeof(AccumulationFileHeader) <= ACCUMULATION_FILE_ALIGNMENT);
+
+// Identifies What An Accumulation Is An Image Of: The Scene's GPU Data (Materials, Primitives, BVH & Lights) & The Camera It Was Seen From
+std::uint64_t HashSceneAndCamera(const Scene& scene, const Camera& camera) noexcept {
+    const std::uint64_t hash = HashBytes(scene.GetGpuData(), scene.GetGpuDataSize());
+    return HashBytes(&camera, sizeof(Camera), hash);
+}
+
+// A Memory Mapped Accumulation File, Either Read (Sequentially) Or Written
+// New Files Are Written As '<filename>.tmp' & Renamed Once Complete, So That A Crash While Checkpointing Keeps The Previous Checkpoint
+class AccumulationFile {
+private:
+#ifdef _WIN32
+    HANDLE m_hFile    = INVALID_HANDLE_VALUE;
+    HANDLE m_hMapping = NULL;
+#endif
+    void*  m_pMapping    = nullptr;
+    size_t m_mappingSize = 0u;
+
+    std::string m_filename;
+    std::string m_writeFilename; // Empty When Read
+
+private:
+    AccumulationFile() = default;
+
+    void Unmap() noexcept {
+#ifdef _WIN32
+        if (this->m_pMapping) UnmapViewOfFile(this->m_pMapping);
+        if (this->m_hMapping) CloseHandle(this->m_hMapping);
+        if (this->m_hFile != INVALID_HANDLE_VALUE) CloseHandle(this->m_hFile);
+
+        this->m_hFile    = INVALID_HANDLE_VALUE;
+        this->m_hMapping = NULL;
+#else
+        if (this->m_pMapping) munmap(this->m_pMapping, this->m_mappingSize);
+#endif
+
+        this->m_pMapping = nullptr;
+    }
+
+public:
+    AccumulationFile(AccumulationFile&& other) noexcept { *this = std::move(other); }
+
+    AccumulationFile& operator=(AccumulationFile&& other) noexcept {
+#ifdef _WIN32
+        std::swap(this->m_hFile, other.m_hFile);
+        std::swap(this->m_hMapping, other.m_hMapping);
+#endif
+        std::swap(this->m_pMapping, other.m_pMapping);
+        std::swap(this->m_mappingSize, other.m_mappingSize);
+        std::swap(this->m_filename, other.m_filename);
+        std::swap(this->m_writeFilename, other.m_writeFilename);
+
+        return *this;
+    }
+
+    AccumulationFile(const AccumulationFile&) = delete;
+    AccumulationFile& operator=(const AccumulationFile&) = delete;
+
+    ~AccumulationFile() { this->Unmap(); }
+
+    static size_t GetFileSize(const AccumulationFileHeader& header) noexcept {
+        return ACCUMULATION_FILE_ALIGNMENT + (header.bAovs ? 3u : 1u) * static_cast<size_t>(header.width) * header.height * sizeof(Colorf32);
+    }
+
+    // Maps A New File Sized For 'header' (Which Is Copied In), It Replaces 'filename' On Commit()
+    static AccumulationFile Create(const std::string& filename, const AccumulationFileHeader& header) {
+        AccumulationFile file;
+        file.m_filename      = filename;
+        file.m_writeFilename = filename + ".tmp";
+        file.m_mappingSize   = GetFileSize(header);
+
+#ifdef _WIN32
+        file.m_hFile = CreateFileA(file.m_writeFilename.c_str(), GENERIC_READ | GENERIC_WRITE, 0, NULL, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, NULL);
+        if (file.m_hFile == INVALID_HANDLE_VALUE)
+            throw std::runtime_error("Failed To Create " + file.m_writeFilename);
+
+        const std::uint64_t size = file.m_mappingSize;
+        file.m_hMapping = CreateFileMappingA(file.m_hFile, NULL, PAGE_READWRITE, static_cast<DWORD>(size >> 32u), static_cast<DWORD>(size), NULL);
+        file.m_pMapping = file.m_hMapping ? MapViewOfFile(file.m_hMapping, FILE_MAP_WRITE, 0, 0, 0) : nullptr;
+#else
+        const int fd = open(file.m_writeFilename.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+        if (fd < 0)
+            throw std::runtime_error("Failed To Create " + file.m_writeFilename);
+
+        file.m_pMapping = (ftruncate(fd, static_cast<off_t>(file.m_mappingSize)) == 0) ? mmap(nullptr, file.m_mappingSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0) : MAP_FAILED;
+        if (file.m_pMapping == MAP_FAILED)
+            file.m_pMapping = nullptr;
+
+        close(fd); // The Mapping Keeps The File Alive
+#endif
+
+        if (!file.m_pMapping)
+            throw std::runtime_error("Failed To Map " + file.m_writeFilename);
+
+        std::memset(file.m_pMapping, 0, ACCUMULATION_FILE_ALIGNMENT);
+        std::memcpy(file.m_pMapping, &header, sizeof(header));
+
+        return file;
+    }
+
+    // Maps An Existing File For Reading, Once Through From Start To End
+    static AccumulationFile Open(const std::string& filename) {
+        AccumulationFile file;
+        file.m_filename = filename;
+
+#ifdef _WIN32
+        file.m_hFile = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+        if (file.m_hFile == INVALID_HANDLE_VALUE)
+            throw std::runtime_error("Failed To Open " + filename);
+
+        LARGE_INTEGER fileSize;
+        GetFileSizeEx(file.m_hFile, &fileSize);
+        file.m_mappingSize = static_cast<size_t>(fileSize.QuadPart);
+
+        file.m_hMapping = CreateFileMappingA(file.m_hFile, NULL, PAGE_READONLY, 0, 0, NULL);
+        file.m_pMapping = file.m_hMapping ? MapViewOfFile(file.m_hMapping, FILE_MAP_READ, 0, 0, 0) : nullptr;
+#else
+        const int fd = open(filename.c_str(), O_RDONLY);
+        if (fd < 0)
+            throw std::runtime_error("Failed To Open " + filename);
+
+        struct stat fileStat;
+        fstat(fd, &fileStat);
+        file.m_mappingSize = static_cast<size_t>(fileStat.st_size);
+
+        file.m_pMapping = (file.m_mappingSize > 0u) ? mmap(nullptr, file.m_mappingSize, PROT_READ, MAP_PRIVATE, fd, 0) : MAP_FAILED;
+        if (file.m_pMapping == MAP_FAILED)
+            file.m_pMapping = nullptr;
+        else
+            madvise(file.m_pMapping, file.m_mappingSize, MADV_SEQUENTIAL); // Read Ahead & Drop The Pages Behind
+
+        close(fd);
+#endif
+
+        if (!file.m_pMapping)
+            throw std::runtime_error("Failed To Map " + filename);
+
+        const AccumulationFileHeader& header = file.GetHeader();
+        if (file.m_mappingSize < ACCUMULATION_FILE_ALIGNMENT || std::memcmp(header.magic, "PACC", 4u) != 0)
+            throw std::runtime_error(filename + " Is Not An Accumulation File");
+
+        if (header.version != ACCUMULATION_FILE_VERSION)
+            throw std::runtime_error(filename + " Has Unsupported Accumulation Version " + std::to_string(header.version));
+
+        if (file.m_mappingSize != GetFileSize(header))
+            throw std::runtime_error(filename + " Is Truncated");
+
+        return file;
+    }
+
+    // Flushes The Written File To Disk & Moves It In Place Of The Previous One
+    void Commit() {
+#ifdef _WIN32
+        const bool bFlushed = FlushViewOfFile(this->m_pMapping, 0) && FlushFileBuffers(this->m_hFile);
+#else
+        const bool bFlushed = msync(this->m_pMapping, this->m_mappingSize, MS_SYNC) == 0;
+#endif
+        this->Unmap();
+
+        if (!bFlushed)
+            throw std::runtime_error("Failed To Write " + this->m_writeFilename);
+
+        std::filesystem::rename(this->m_writeFilename, this->m_filename);
+    }
+
+    const AccumulationFileHeader& GetHeader() const noexcept { return *static_cast<const AccumulationFileHeader*>(this->m_pMapping); }
+
+    Colorf32* GetAccumulation() const noexcept { return reinterpret_cast<Colorf32*>(static_cast<std::uint8_t*>(this->m_pMapping) + ACCUMULATION_FILE_ALIGNMENT); }
+    Colorf32* GetAovs()         const noexcept { return this->GetAccumulation() + static_cast<size_t>(this->GetHeader().width) * this->GetHeader().height; }
+}; // AccumulationFile
+
+// A Render's --checkpoint: The Samples Resumed From The File, Which Are Added To The Ones This Run Traces, & The Periodic Writes
+// The Whole Frame Is Written Each Time (Accumulation & AOVs), Only A Single Frame Without --adaptive (Whose Moments Stay On The GPU) Can Be Checkpointed
+class Checkpointer {
+private:
+    const CommandLineArguments& m_commandLineArguments;
+
+    std::uint64_t         m_sceneHash;
+    std::uint32_t         m_resumedSampleCount = 0u;
+    std::vector<Colorf32> m_resumed; // The File's Accumulation & AOVs, Empty When Starting Over
+
+    std::chrono::steady_clock::time_point m_lastWrite;
+
+public:
+    Checkpointer(const CommandLineArguments& commandLineArguments, const Scene& scene, const Camera& camera)
+        : m_commandLineArguments(commandLineArguments), m_sceneHash(commandLineArguments.checkpointFilename.empty() ? 0u : HashSceneAndCamera(scene, camera)),
+          m_lastWrite(std::chrono::steady_clock::now())
+    {
+        const std::string& filename = commandLineArguments.checkpointFilename;
+        if (filename.empty())
+            return;
+
+        if (commandLineArguments.frameCount > 1u)
+            throw std::runtime_error("--checkpoint Needs A Single Frame");
+        if (commandLineArguments.adaptiveThreshold > 0.f)
+            throw std::runtime_error("--checkpoint Can't Be Combined With --adaptive");
+        if (commandLineArguments.bOutOfCore)
+            throw std::runtime_error("--checkpoint Needs The Whole Accumulation, Which --out-of-core Never Holds");
+
+        if (!std::filesystem::exists(filename))
+            return;
+
+        const AccumulationFile        file   = AccumulationFile::Open(filename);
+        const AccumulationFileHeader& header = file.GetHeader();
+
+        // Resuming Any Other Render Would Mix Different Images Or Repeat Samples
+        if (header.width != commandLineArguments.surfaceWidth || header.height != commandLineArguments.surfaceHeight || header.frameIndex != 0u ||
+            (header.bAovs != 0u) != commandLineArguments.bAovs || header.sampleSequence != static_cast<std::uint32_t>(commandLineArguments.sampleSequence) ||
+            header.maxBounces != commandLineArguments.maxBounces || header.sceneHash != this->m_sceneHash || header.sampleBegin != commandLineArguments.sampleOffset ||
+            header.samplesPerPixel != header.sampleEnd - header.sampleBegin)
+            throw std::runtime_error(filename + " Belongs To Another Render, Delete It To Start Over");
+
+        // The File's Samples Can't Be Split Back Out, So It Can Only Be Resumed Toward At Least As Many
+        if (header.samplesPerPixel > commandLineArguments.samplesPerPixel)
+            throw std::runtime_error(filename + " Already Holds " + std::to_string(header.samplesPerPixel) + " Samples Per Pixel, More Than --spp " +
+                                     std::to_string(commandLineArguments.samplesPerPixel));
+
+        this->m_resumedSampleCount = static_cast<std::uint32_t>(header.samplesPerPixel);
+
+        const size_t pixelCount = static_cast<size_t>(header.width) * header.height;
+        this->m_resumed.assign(file.GetAccumulation(), file.GetAccumulation() + (header.bAovs ? 3u : 1u) * pixelCount);
+
+        std::printf("Resuming %s: %u Samples Per Pixel Already Traced\n", filename.c_str(), this->m_resumedSampleCount);
+    }
+
+    bool IsEnabled() const noexcept { return !this->m_commandLineArguments.checkpointFilename.empty(); }
+
+    bool IsDue() const noexcept {
+        return this->IsEnabled() && std::chrono::duration<float>(std::chrono::steady_clock::now() - this->m_lastWrite).count() >= this->m_commandLineArguments.checkpointInterval;
+    }
+
+    // The Samples Per Pixel Left To This Run & The Index Of Its First One
+    std::uint32_t GetSampleCount() const noexcept { return this->m_commandLineArguments.samplesPerPixel - this->m_resumedSampleCount; }
+    std::uint32_t GetFirstSample() const noexcept { return this->m_commandLineArguments.sampleOffset + this->m_resumedSampleCount; }
+
+    // Adds The Resumed Samples To This Run's Accumulation (& AOVs)
+    void AddResumed(Colorf32* pAccumulation, Colorf32* pAovs) const noexcept {
+        if (this->m_resumed.empty())
+            return;
+
+        const size_t pixelCount = static_cast<size_t>(this->m_commandLineArguments.surfaceWidth) * this->m_commandLineArguments.surfaceHeight;
+
+        ParallelFor(this->m_resumed.size(), 1u << 16, [&](const size_t begin, const size_t end) {
+            for (size_t i = begin; i < end; i++) {
+                Colorf32&       dst = (i < pixelCount) ? pAccumulation[i] : pAovs[i - pixelCount];
+                const Colorf32& src = this->m_resumed[i];
+                dst = Colorf32{ dst.r + src.r, dst.g + src.g, dst.b + src.b, dst.a + src.a };
+            }
+        });
+    }
+
+    // Writes An Accumulation (Including The Resumed Samples) Holding 'sampleCount' Samples Per Pixel Past The Resumed Ones
+    void Write(const Colorf32* pAccumulation, const Colorf32* pAovs, const std::uint32_t sampleCount) {
+        const auto writeStart = std::chrono::steady_clock::now();
+
+        AccumulationFileHeader header = {};
+        std::memcpy(header.magic, "PACC", 4u);
+        header.version         = ACCUMULATION_FILE_VERSION;
+        header.width           = this->m_commandLineArguments.surfaceWidth;
+        header.height          = this->m_commandLineArguments.surfaceHeight;
+        header.frameIndex      = 0u;
+        header.bAovs           = this->m_commandLineArguments.bAovs ? 1u : 0u;
+        header.sampleSequence  = static_cast<std::uint32_t>(this->m_commandLineArguments.sampleSequence);
+        header.maxBounces      = this->m_commandLineArguments.maxBounces;
+        header.sceneHash       = this->m_sceneHash;
+        header.sampleBegin     = this->m_commandLineArguments.sampleOffset;
+        header.samplesPerPixel = this->m_resumedSampleCount + sampleCount;
+        header.sampleEnd       = header.sampleBegin + header.samplesPerPixel;
+
+        AccumulationFile file = AccumulationFile::Create(this->m_commandLineArguments.checkpointFilename, header);
+
+        const size_t pixelCount = static_cast<size_t>(header.width) * header.height;
+        std::memcpy(file.GetAccumulation(), pAccumulation, pixelCount * sizeof(Colorf32));
+        if (header.bAovs)
+            std::memcpy(file.GetAovs(), pAovs, 2u * pixelCount * sizeof(Colorf32));
+
+        file.Commit();
+
+        this->m_lastWrite = std::chrono::steady_clock::now();
+
+        std::printf("Checkpoint: %llu Samples Per Pixel Written To %s In %.3fms\n", static_cast<unsigned long long>(header.samplesPerPixel),
+            this->m_commandLineArguments.checkpointFilename.c_str(), std::chrono::duration<float, std::milli>(this->m_lastWrite - writeStart).count());
+    }
+}; // Checkpointer
+
+// ./PolarTracer merge <file>... [--output <name>] [--checkpoint <merged.pacc>] [--denoise atrous] [--aov ...] [--format ...] [--tonemap ...]
+// Sums Accumulation Files Rendered With Disjoint Sample Ranges (--sample-offset) Into One Frame. Each Pixel's Samples Are Summed
+// With Their Count, So The Resolve Weighs Every Input By Its Sample Count. The Inputs Are Mapped One At A Time & Read Through Once
+void RunMerge(const CommandLineArguments& commandLineArguments, Profiler& profiler) {
+    CommandLineArguments mergeArguments = commandLineArguments;
+
+    AccumulationFileHeader merged = {};
+    std::vector<Colorf32>  accumulation;
+    std::vector<std::pair<std::uint64_t, std::uint64_t>> sampleRanges;
+
+    for (const std::string& filename : commandLineArguments.mergeFilenames) {
+        const ProfileScope profileScope(profiler, "Merge " + filename);
+
+        const AccumulationFile        file   = AccumulationFile::Open(filename);
+        const AccumulationFileHeader& header = file.GetHeader();
+
+        std::printf("%s: %ux%u, Samples [%llu, %llu)%s\n", filename.c_str(), header.width, header.height,
+            static_cast<unsigned long long>(header.sampleBegin), static_cast<unsigned long long>(header.sampleEnd), header.bAovs ? ", AOVs" : "");
+
+        const size_t pixelCount = static_cast<size_t>(header.width) * header.height;
+        if (accumulation.empty()) {
+            merged = header;
+            merged.samplesPerPixel = 0u;
+            accumulation.assign((header.bAovs ? 3u : 1u) * pixelCount, Colorf32{ 0.f, 0.f, 0.f, 0.f });
+        } else if (header.width != merged.width || header.height != merged.height || header.frameIndex != merged.frameIndex ||
+                   header.sampleSequence != merged.sampleSequence || header.maxBounces != merged.maxBounces || header.sceneHash != merged.sceneHash) {
+            throw std::runtime_error(filename + " Wasn't Rendered With The Same Size, Frame, Sampler, Bounces, Scene & Camera As " + commandLineArguments.mergeFilenames.front());
+        }
+
+        // The AOVs Are Only Kept When Every Input Has Them
+        if (!header.bAovs && merged.bAovs) {
+            merged.bAovs = 0u;
+            accumulation.resize(pixelCount);
+        }
+
+        const Colorf32* pInput     = file.GetAccumulation();
+        const size_t    entryCount = accumulation.size();
+        ParallelFor(entryCount, 1u << 16, [&](const size_t begin, const size_t end) {
+            for (size_t i = begin; i < end; i++) {
+                const Colorf32& src = pInput[i];
+                Colorf32&       dst = accumulation[i];
+                dst = Colorf32{ dst.r + src.r, dst.g + src.g, dst.b + src.b, dst.a + src.a };
+            }
+        });
+
+        merged.sampleBegin      = std::min(merged.sampleBegin, header.sampleBegin);
+        merged.sampleEnd        = std::max(merged.sampleEnd, header.sampleEnd);
+        merged.samplesPerPixel += header.samplesPerPixel;
+        sampleRanges.emplace_back(header.sampleBegin, header.sampleEnd);
+    }
+
+    if (accumulation.empty())
+        throw std::runtime_error("Nothing To Merge");
+
+    // Two Renders Of The Same Samples Would Count Them Twice
+    std::sort(sampleRanges.begin(), sampleRanges.end());
+    bool bContiguous = true;
+    for (size_t i = 1u; i < sampleRanges.size(); i++) {
+        if (sampleRanges[i].first < sampleRanges[i - 1u].second)
+            throw std::runtime_error("The Inputs' Sample Ranges Overlap, Their Common Samples Would Be Counted Twice");
+
+        bContiguous = bContiguous && sampleRanges[i].first == sampleRanges[i - 1u].second;
+    }
+
+    // A .pacc's Range Is What Resuming & Merging Trust, So It Never Claims Samples That Weren't Traced
+    if (!bContiguous && !commandLineArguments.checkpointFilename.empty())
+        throw std::runtime_error("The Inputs' Sample Ranges Leave Gaps, Which A Merged --checkpoint Can't Describe");
+
+    std::printf("Merged %zu Files: %llu Samples Per Pixel\n", commandLineArguments.mergeFilenames.size(), static_cast<unsigned long long>(merged.samplesPerPixel));
+
+    if (!commandLineArguments.checkpointFilename.empty()) {
+        AccumulationFile file = AccumulationFile::Create(commandLineArguments.checkpointFilename, merged);
+        std::memcpy(file.GetAccumulation(), accumulation.data(), accumulation.size() * sizeof(Colorf32));
+        file.Commit();
+    }
+
+    mergeArguments.surfaceWidth  = merged.width;
+    mergeArguments.surfaceHeight = merged.height;
+    mergeArguments.frameCount    = 1u;
+    if (!merged.bAovs && mergeArguments.bAovs) {
+        std::printf("Not Every Input Has AOVs, Saving Without Denoising Nor AOVs\n");
+        mergeArguments.bAovs      = false;
+        mergeArguments.bDenoise   = false;
+        mergeArguments.aovExports = 0u;
+    }
+
+    const size_t pixelCount = static_cast<size_t>(merged.width) * merged.height;
+    SaveFrame(mergeArguments, accumulation.data(), merged.bAovs ? (accumulation.data() + pixelCount) : nullptr,
+        GetFrameOutputFilename(mergeArguments, merged.frameIndex), merged.frameIndex, profiler);
+}
+
+// CPU Backend: The Intersection Routines, GenerateCameraRay & TracePath Of shader.glsl, Traced In SIMD Packets Of Horizontally Adjacent Pixels
+// Every Lane Keeps Its Own Sampler So That Packets Produce The Same Image As The Scalar Path & The GPU
+namespace CpuTracer {
+
+    constexpr float NO_HIT  = 3.402823466e+38f; // The Shader's FLT_MAX
+    constexpr float EPSILON = 0.001f;
+
+    constexpr float PARALLEL_EPSILON = 1e-6f; // Rays This Close To Parallel Miss Planes
+    constexpr float PI               = 3.1415926535897f;
+
+    // The CPU Equivalent Of The Specialization & Push Constants Of A Pass
+    struct PassParameters {
+        std::uint32_t width, height;
+        std::uint32_t firstRow, rowCount; // The Rows Traced, Which The Accumulation & AOVs Hold: Every Row Unless Rendering Out Of Core
+        std::uint32_t maxIterations;
+        std::uint32_t sampleOffset, sampleCount;
+        std::uint32_t frameIndex;
+        SampleSequence sampleSequence;
+
+        // Read Straight From The Scene's Sections
+        const SceneMaterial* pMaterials;
+        const SceneSphere*   pSpheres;
+        const ScenePlane*    pPlanes;
+        const SceneTriangle* pTriangles;
+        const SceneBvhNode*  pBvhNodes;
+        const SceneLight*    pLights;
+        std::uint32_t        sphereCount, planeCount, bvhNodeCount, lightCount;
+
+        Colorf32* pAovs; // Two Per Pixel Like The Shader's aovs[] (Row Pitch = 2 * width, From firstRow), nullptr Not To Record Them
+
+        float position[3];
+        float right[3], up[3], forward[3];
+        float projectW, projectH;
+    }; // PassParameters
+
+    PassParameters MakePassParameters(const Scene& scene, const Camera& camera, const std::uint32_t width, const std::uint32_t height, const std::uint32_t maxIterations,
+                                      const std::uint32_t sampleOffset, const std::uint32_t sampleCount, const std::uint32_t frameIndex, const SampleSequence sampleSequence,
+                                      Colorf32* pAovs = nullptr) noexcept {
+        auto Normalize = [](float v[3]) {
+            const float length = std::sqrt(v[0] * v[0] + v[1] * v[1] + v[2] * v[2]);
+            for (size_t c = 0u; c < 3u; c++)
+                v[c] /= length;
+        };
+
+        PassParameters pass;
+        pass.width         = width;
+        pass.height        = height;
+        pass.firstRow      = 0u;
+        pass.rowCount      = height;
+        pass.maxIterations = maxIterations;
+        pass.sampleOffset  = sampleOffset;
+        pass.sampleCount   = sampleCount;
+        pass.frameIndex    = frameIndex;
+        pass.sampleSequence = sampleSequence;
+        pass.pMaterials    = scene.GetMaterials();
+        pass.pSpheres      = scene.GetSpheres();
+        pass.pPlanes       = scene.GetPlanes();
+        pass.sphereCount   = scene.GetSectionCount(eSceneSectionSpheres);
+        pass.planeCount    = scene.GetSectionCount(eSceneSectionPlanes);
+        pass.pTriangles    = scene.GetTriangles();
+        pass.pBvhNodes     = scene.GetBvhNodes();
+        pass.bvhNodeCount  = scene.GetSectionCount(eSceneSectionBvhNodes);
+        pass.pLights       = scene.GetLights();
+        pass.lightCount    = scene.GetSectionCount(eSceneSectionLights);
+        pass.pAovs         = pAovs;
+
+        // Same Basis As The Shader: right = cross(up, forward), up = cross(forward, right)
+        for (size_t c = 0u; c < 3u; c++) {
+            pass.position[c] = camera.position[c];
+            pass.forward[c]  = camera.target[c] - camera.position[c];
+        }
+        Normalize(pass.forward);
+
+        pass.right[0] = pass.forward[2];
+        pass.right[1] = 0.f;
+        pass.right[2] = -pass.forward[0];
+        Normalize(pass.right);
+
+        pass.up[0] = pass.forward[1] * pass.right[2] - pass.forward[2] * pass.right[1];
+        pass.up[1] = pass.forward[2] * pass.right[0] - pass.forward[0] * pass.right[2];
+        pass.up[2] = pass.forward[0] * pass.right[1] - pass.forward[1] * pass.right[0];
+
+        pass.projectH = std::tan(3.1415926535897f / 5.f);
+        pass.projectW = pass.projectH * static_cast<float>(width) / static_cast<float>(height);
+
+        return pass;
+    }
+
+    // The Sampler Of common.glsl, Bit For Bit (See BeginSample & SampleDimensions)
+    struct Sampler {
+        std::uint32_t seed;  // Hash Of The Pixel & Frame
+        std::uint32_t index; // The Sample's Index In Its Pixel's Sequence
+        std::uint32_t state; // PCG State
+    }; // Sampler
+
+    constexpr std::uint32_t LOW_DISCREPANCY_DIMENSION_GROUPS = 7u; // The Camera & The Light And Direction Samples Of The First Three Bounces
+
+    // The Direction Numbers Of Sobol's First Three Dimensions (Joe & Kuo)
+    constexpr std::uint32_t SOBOL_DIRECTIONS[3u][32u] = {
+        { 0x80000000u, 0x40000000u, 0x20000000u, 0x10000000u, 0x08000000u, 0x04000000u, 0x02000000u, 0x01000000u, 0x00800000u, 0x00400000u, 0x00200000u, 0x00100000u, 0x00080000u, 0x00040000u, 0x00020000u, 0x00010000u, 0x00008000u, 0x00004000u, 0x00002000u, 0x00001000u, 0x00000800u, 0x00000400u, 0x00000200u, 0x00000100u, 0x00000080u, 0x00000040u, 0x00000020u, 0x00000010u, 0x00000008u, 0x00000004u, 0x00000002u, 0x00000001u },
+        { 0x80000000u, 0xc0000000u, 0xa0000000u, 0xf0000000u, 0x88000000u, 0xcc000000u, 0xaa000000u, 0xff000000u, 0x80800000u, 0xc0c00000u, 0xa0a00000u, 0xf0f00000u, 0x88880000u, 0xcccc0000u, 0xaaaa0000u, 0xffff0000u, 0x80008000u, 0xc000c000u, 0xa000a000u, 0xf000f000u, 0x88008800u, 0xcc00cc00u, 0xaa00aa00u, 0xff00ff00u, 0x80808080u, 0xc0c0c0c0u, 0xa0a0a0a0u, 0xf0f0f0f0u, 0x88888888u, 0xccccccccu, 0xaaaaaaaau, 0xffffffffu },
+        { 0x80000000u, 0xc0000000u, 0x60000000u, 0x90000000u, 0xe8000000u, 0x5c000000u, 0x8e000000u, 0xc5000000u, 0x68800000u, 0x9cc00000u, 0xee600000u, 0x55900000u, 0x80680000u, 0xc09c0000u, 0x60ee0000u, 0x90550000u, 0xe8808000u, 0x5cc0c000u, 0x8e606000u, 0xc5909000u, 0x6868e800u, 0x9c9c5c00u, 0xeeee8e00u, 0x5555c500u, 0x8000e880u, 0xc0005cc0u, 0x60008e60u, 0x9000c590u, 0xe8006868u, 0x5c009c9cu, 0x8e00eeeeu, 0xc5005555u }
+    };
+
+    inline std::uint32_t PcgPermute(const std::uint32_t state) noexcept {
+        const std::uint32_t word = ((state >> ((state >> 28u) + 4u)) ^ state) * 277803737u;
+        return (word >> 22u) ^ word;
+    }
+
+    inline std::uint32_t Hash(const std::uint32_t value) noexcept {
+        return PcgPermute(value * 747796405u + 2891336453u);
+    }
+
+    inline std::uint32_t HashCombine(const std::uint32_t seed, const std::uint32_t value) noexcept {
+        return seed ^ (value + (seed << 6u) + (seed >> 2u));
+    }
+
+    inline float ToUnitFloat(const std::uint32_t bits) noexcept {
+        return static_cast<float>(bits >> 8u) * (1.f / 16777216.f);
+    }
+
+    inline std::uint32_t ReverseBits(std::uint32_t x) noexcept {
+        x = ((x >> 1u) & 0x55555555u) | ((x & 0x55555555u) << 1u);
+        x = ((x >> 2u) & 0x33333333u) | ((x & 0x33333333u) << 2u);
+        x = ((x >> 4u) & 0x0f0f0f0fu) | ((x & 0x0f0f0f0fu) << 4u);
+        x = ((x >> 8u) & 0x00ff00ffu) | ((x & 0x00ff00ffu) << 8u);
+        return (x >> 16u) | (x << 16u);
+    }
+
+    inline std::uint32_t Sobol(std::uint32_t index, const std::uint32_t dimension) noexcept {
+        std::uint32_t result = 0u;
+        for (std::uint32_t bit = 0u; index != 0u; bit++, index >>= 1u)
+            if (index & 1u)
+                result ^= SOBOL_DIRECTIONS[dimension][bit];
+
+        return result;
+    }
+
+    inline std::uint32_t NestedUniformScramble(std::uint32_t x, const std::uint32_t seed) noexcept {
+        x  = ReverseBits(x);
+        x += seed;
+        x ^= x * 0x6c50b47cu;
+        x ^= x * 0xb82f1e52u;
+        x ^= x * 0xc7afe638u;
+        x ^= x * 0x8d22f6e6u;
+        return ReverseBits(x);
+    }
+
+    inline Sampler BeginSample(const PassParameters& pass, const std::uint32_t pixelX, const std::uint32_t pixelY, const std::uint32_t sampleIndex) noexcept {
+        Sampler sampler;
+        sampler.seed  = Hash((pixelY * pass.width + pixelX) ^ Hash(pass.frameIndex));
+        sampler.index = pass.sampleOffset + sampleIndex;
+        sampler.state = HashCombine(sampler.seed, Hash(sampler.index));
+        return sampler;
+    }
+
+    inline float RandomFloat(Sampler& sampler) noexcept {
+        sampler.state = sampler.state * 747796405u + 2891336453u;
+        return ToUnitFloat(PcgPermute(sampler.state));
+    }
+
+    // The Camera Is Group 0, Bounce N Samples A Light With Group 2N + 1 & Its Next Direction With Group 2N + 2
+    inline void SampleDimensions(const PassParameters& pass, Sampler& sampler, const std::uint32_t dimensionGroup, const std::uint32_t dimensionCount, float* pResult) noexcept {
+        if (pass.sampleSequence == SampleSequence::eSobolOwen && dimensionGroup < LOW_DISCREPANCY_DIMENSION_GROUPS) {
+            const std::uint32_t groupSeed = HashCombine(sampler.seed, dimensionGroup);
+            const std::uint32_t index     = NestedUniformScramble(sampler.index, groupSeed);
+
+            for (std::uint32_t dimension = 0u; dimension < dimensionCount; dimension++)
+                pResult[dimension] = ToUnitFloat(NestedUniformScramble(Sobol(index, dimension), HashCombine(groupSeed, dimension + 1u)));
+        } else {
+            for (std::uint32_t dimension = 0u; dimension < dimensionCount; dimension++)
+                pResult[dimension] = RandomFloat(sampler);
+        }
+    }
+
+    inline void GenerateCameraRay(const PassParameters& pass, const std::uint32_t pixelX, const std::uint32_t pixelY, Sampler& sampler,
+                                  float origin[3], float direction[3]) noexcept {
+        float jitter[2];
+        SampleDimensions(pass, sampler, 0u, 2u, jitter);
+
+        const float x = ( 2.f * ((pixelX + jitter[0]) / static_cast<float>(pass.width))  - 1.f) * pass.projectW;
+        const float y = (-2.f * ((pixelY + jitter[1]) / static_cast<float>(pass.height)) + 1.f) * pass.projectH;
+
+        float length2 = 0.f;
+        for (size_t c = 0u; c < 3u; c++) {
+            origin[c]    = pass.position[c];
+            direction[c] = x * pass.right[c] + y * pass.up[c] + pass.forward[c];
+            length2     += direction[c] * direction[c];
+        }
+
+        const float length = std::sqrt(length2);
+        for (size_t c = 0u; c < 3u; c++)
+            direction[c] /= length;
+    }
+
+    // Slab Test Against [0, tMax)
+    inline bool IntersectsBounds(const SceneBvhNode& node, const float o[3], const float inverseDirection[3], const float tMax) noexcept {
+        float t0[3], t1[3];
+        for (size_t c = 0u; c < 3u; c++) {
+            t0[c] = (node.boundsMin[c] - o[c]) * inverseDirection[c];
+            t1[c] = (node.boundsMax[c] - o[c]) * inverseDirection[c];
+        }
+
+        const float tNear = std::max(std::max(std::min(t0[0], t1[0]), std::min(t0[1], t1[1])), std::max(std::min(t0[2], t1[2]), 0.f));
+        const float tFar  = std::min(std::min(std::max(t0[0], t1[0]), std::max(t0[1], t1[1])), std::min(std::max(t0[2], t1[2]), tMax));
+
+        return tNear <= tFar;
+    }
+
+    // Moller-Trumbore, Returns NO_HIT On A Miss
+    inline float IntersectsTriangle(const SceneTriangle& triangle, const float o[3], const float d[3]) noexcept {
+        const float* e1 = triangle.edge1;
+        const float* e2 = triangle.edge2;
+
+        const float p[3] = { d[1] * e2[2] - d[2] * e2[1], d[2] * e2[0] - d[0] * e2[2], d[0] * e2[1] - d[1] * e2[0] };
+        const float det  = e1[0] * p[0] + e1[1] * p[1] + e1[2] * p[2];
+        if (det == 0.f)
+            return NO_HIT;
+
+        const float inverseDet = 1.f / det;
+        const float tv[3] = { o[0] - triangle.v0[0], o[1] - triangle.v0[1], o[2] - triangle.v0[2] };
+        const float u     = (tv[0] * p[0] + tv[1] * p[1] + tv[2] * p[2]) * inverseDet;
+
+        const float q[3] = { tv[1] * e1[2] - tv[2] * e1[1], tv[2] * e1[0] - tv[0] * e1[2], tv[0] * e1[1] - tv[1] * e1[0] };
+        const float v    = (d[0] * q[0] + d[1] * q[1] + d[2] * q[2]) * inverseDet;
+        const float t    = (e2[0] * q[0] + e2[1] * q[1] + e2[2] * q[2]) * inverseDet;
+
+        if (!(u >= 0.f && v >= 0.f && u + v <= 1.f && t >= EPSILON))
+            return NO_HIT;
+
+        return t;
+    }
+
+    // The Unnormalized Geometric Normal
+    inline void GetTriangleNormal(const SceneTriangle& triangle, float normal[3]) noexcept {
+        const float* e1 = triangle.edge1;
+        const float* e2 = triangle.edge2;
+
+        normal[0] = e1[1] * e2[2] - e1[2] * e2[1];
+        normal[1] = e1[2] * e2[0] - e1[0] * e2[2];
+        normal[2] = e1[0] * e2[1] - e1[1] * e2[0];
+    }
+
+    // Like The Shader's Intersects(Ray, Sphere): The Near Hit, Or The Far One When The Origin Is (Nearly) On/Inside The Sphere
+    inline float IntersectsSphere(const SceneSphere& sphere, const float o[3], const float d[3]) noexcept {
+        const float L[3]    = { sphere.center[0] - o[0], sphere.center[1] - o[1], sphere.center[2] - o[2] };
+        const float tca     = L[0] * d[0] + L[1] * d[1] + L[2] * d[2];
+        const float d2      = L[0] * L[0] + L[1] * L[1] + L[2] * L[2] - tca * tca;
+        const float radius2 = sphere.radius * sphere.radius;
+
+        if (d2 > radius2)
+            return NO_HIT;
+
+        const float thc = std::sqrt(radius2 - d2);
+        float t0 = std::min(tca - thc, tca + thc);
+        const float t1 = std::max(tca - thc, tca + thc);
+
+        if (t0 < EPSILON) {
+            t0 = t1;
+            if (t0 < 0.f)
+                return NO_HIT;
+        }
+
+        return t0;
+    }
+
+    // Returns NO_HIT When Parallel Or Behind, 'denominator' Tells Which Side The Ray Comes From
+    inline float IntersectsPlane(const ScenePlane& plane, const float o[3], const float d[3], float& denominator) noexcept {
+        denominator = plane.normal[0] * d[0] + plane.normal[1] * d[1] + plane.normal[2] * d[2];
+        if (std::abs(denominator) < PARALLEL_EPSILON)
+            return NO_HIT;
+
+        const float t = ((plane.point[0] - o[0]) * plane.normal[0] + (plane.point[1] - o[1]) * plane.normal[1] + (plane.point[2] - o[2]) * plane.normal[2]) / denominator;
+        return (t < EPSILON) ? NO_HIT : t;
+    }
+
+    // The Closest Hit Of A Ray, Like The Shader's Intersection
+    struct Hit {
+        float         t;             // NO_HIT On A Miss
+        float         normal[3];     // Unnormalized, Facing The Incoming Ray (Spheres: Outwards)
+        std::uint32_t materialIndex;
+        std::uint32_t lightIndex;    // SCENE_NO_LIGHT If It Can't Be Sampled
+    }; // Hit
+
+    inline Hit FindClosestIntersection(const PassParameters& pass, const float o[3], const float d[3]) noexcept {
+        Hit hit = { NO_HIT, { 0.f, 0.f, 0.f }, 0u, SCENE_NO_LIGHT };
+
+        for (std::uint32_t i = 0u; i < pass.sphereCount; i++) {
+            const SceneSphere& sphere = pass.pSpheres[i];
+
+            const float t = IntersectsSphere(sphere, o, d);
+            if (t < hit.t) {
+                hit.t             = t;
+                hit.materialIndex = sphere.materialIndex;
+                hit.lightIndex    = sphere.lightIndex;
+                for (size_t c = 0u; c < 3u; c++)
+                    hit.normal[c] = (o[c] + t * d[c]) - sphere.center[c];
+            }
+        }
+
+        for (std::uint32_t i = 0u; i < pass.planeCount; i++) {
+            const ScenePlane& plane = pass.pPlanes[i];
+
+            float denominator;
+            const float t = IntersectsPlane(plane, o, d, denominator);
+            if (t < hit.t) {
+                hit.t             = t;
+                hit.materialIndex = plane.materialIndex;
+                hit.lightIndex    = SCENE_NO_LIGHT;
+                for (size_t c = 0u; c < 3u; c++)
+                    hit.normal[c] = (denominator < 0.f) ? plane.normal[c] : -plane.normal[c]; // Facing The Incoming Ray
+            }
+        }
+
+        // Stackless Walk Of The Threaded BVH
+        const float inverseDirection[3] = { 1.f / d[0], 1.f / d[1], 1.f / d[2] };
+        for (std::uint32_t nodeIndex = 0u; nodeIndex < pass.bvhNodeCount; ) {
+            const SceneBvhNode& node = pass.pBvhNodes[nodeIndex];
+
+            if (!IntersectsBounds(node, o, inverseDirection, hit.t)) {
+                nodeIndex = node.primitiveCount ? nodeIndex + 1u : node.index;
+                continue;
+            }
+
+            for (std::uint32_t i = node.index; i < node.index + node.primitiveCount; i++) {
+                const float t = IntersectsTriangle(pass.pTriangles[i], o, d);
+                if (t < hit.t) {
+                    hit.t             = t;
+                    hit.materialIndex = pass.pTriangles[i].materialIndex;
+                    hit.lightIndex    = pass.pTriangles[i].lightIndex;
+
+                    float normal[3];
+                    GetTriangleNormal(pass.pTriangles[i], normal);
+
+                    const bool bFlip = normal[0] * d[0] + normal[1] * d[1] + normal[2] * d[2] > 0.f; // Facing The Incoming Ray
+                    for (size_t c = 0u; c < 3u; c++)
+                        hit.normal[c] = bFlip ? -normal[c] : normal[c];
+                }
+            }
+
+            nodeIndex++;
+        }
+
+        return hit;
+    }
+
+    // Shadow Rays: Whether Anything Is Hit In [EPSILON, tMax), Stopping At The First Hit
+    inline bool IsOccluded(const PassParameters& pass, const float o[3], const float d[3], const float tMax) noexcept {
+        for (std::uint32_t i = 0u; i < pass.sphereCount; i++)
+            if (IntersectsSphere(pass.pSpheres[i], o, d) < tMax)
+                return true;
+
+        for (std::uint32_t i = 0u; i < pass.planeCount; i++) {
+            float denominator;
+            if (IntersectsPlane(pass.pPlanes[i], o, d, denominator) < tMax)
+                return true;
+        }
+
+        const float inverseDirection[3] = { 1.f / d[0], 1.f / d[1], 1.f / d[2] };
+        for (std::uint32_t nodeIndex = 0u; nodeIndex < pass.bvhNodeCount; ) {
+            const SceneBvhNode& node = pass.pBvhNodes[nodeIndex];
+
+            if (!IntersectsBounds(node, o, inverseDirection, tMax)) {
+                nodeIndex = node.primitiveCount ? nodeIndex + 1u : node.index;
+                continue;
+            }
+
+            for (std::uint32_t i = node.index; i < node.index + node.primitiveCount; i++)
+                if (IntersectsTriangle(pass.pTriangles[i], o, d) < tMax)
+                    return true;
+
+            nodeIndex++;
+        }
+
+        return false;
+    }
+
+    // An Orthonormal Basis Around The Unit Vector 'n' (Duff et al. 2017)
+    inline void BuildBasis(const float n[3], float tangent[3], float bitangent[3]) noexcept {
+        const float s = (n[2] >= 0.f) ? 1.f : -1.f;
+        const float a = -1.f / (s + n[2]);
+        const float b = n[0] * n[1] * a;
+
+        tangent[0]   = 1.f + s * n[0] * n[0] * a; tangent[1]   = s * b;                 tangent[2]   = -s * n[0];
+        bitangent[0] = b;                         bitangent[1] = s + n[1] * n[1] * a;   bitangent[2] = -n[1];
+    }
+
+    inline void Normalize(float v[3]) noexcept {
+        const float length = std::sqrt(v[0] * v[0] + v[1] * v[1] + v[2] * v[2]);
+        for (size_t c = 0u; c < 3u; c++)
+            v[c] /= length;
+    }
+
+    // Lambertian Scattering: Directions Around 'normal' With pdf = cos / PI
+    inline float SampleCosineHemisphere(const float normal[3], const float u[2], float direction[3]) noexcept {
+        float tangent[3], bitangent[3];
+        BuildBasis(normal, tangent, bitangent);
+
+        const float r        = std::sqrt(u[0]);
+        const float phi      = 2.f * PI * u[1];
+        const float cosTheta = std::sqrt(std::max(1.f - u[0], 0.f));
+
+        for (size_t c = 0u; c < 3u; c++)
+            direction[c] = r * std::cos(phi) * tangent[c] + r * std::sin(phi) * bitangent[c] + cosTheta * normal[c];
+        Normalize(direction);
+
+        return cosTheta / PI;
+    }
+
+    // Binary Search Of The Lights' CDF
+    inline std::uint32_t SelectLight(const PassParameters& pass, const float u) noexcept {
+        std::uint32_t first = 0u, last = pass.lightCount - 1u;
+        while (first < last) {
+            const std::uint32_t middle = (first + last) / 2u;
+            if (u < pass.pLights[middle].cdf)
+                last = middle;
+            else
+                first = middle + 1u;
+        }
+
+        return first;
+    }
+
+    // Uniform Over The Cone The Sphere Subtends, 0 From Inside
+    inline float SphereSolidAnglePdf(const SceneSphere& sphere, const float origin[3]) noexcept {
+        const float toCenter[3] = { sphere.center[0] - origin[0], sphere.center[1] - origin[1], sphere.center[2] - origin[2] };
+        const float distance2   = toCenter[0] * toCenter[0] + toCenter[1] * toCenter[1] + toCenter[2] * toCenter[2];
+        const float radius2     = sphere.radius * sphere.radius;
+        if (distance2 <= radius2)
+            return 0.f;
+
+        const float sin2ThetaMax = radius2 / distance2;
+        const float cosThetaMax  = std::sqrt(std::max(1.f - sin2ThetaMax, 0.f));
+
+        return 1.f / (2.f * PI * (sin2ThetaMax / (1.f + cosThetaMax)));
+    }
+
+    // Samples A Point On A Light As Seen From 'origin', Returns False When The Light Can't Be Seen From There
+    inline bool SampleLight(const PassParameters& pass, const SceneLight& light, const float origin[3], const float u[2],
+                            float direction[3], float& distance, float& pdf) noexcept {
+        if (light.primitiveType == eSceneLightSphere) {
+            const SceneSphere& sphere = pass.pSpheres[light.primitiveIndex];
+
+            pdf = SphereSolidAnglePdf(sphere, origin);
+            if (pdf == 0.f)
+                return false;
+
+            const float toCenter[3]    = { sphere.center[0] - origin[0], sphere.center[1] - origin[1], sphere.center[2] - origin[2] };
+            const float distance2      = toCenter[0] * toCenter[0] + toCenter[1] * toCenter[1] + toCenter[2] * toCenter[2];
+            const float centerDistance = std::sqrt(distance2);
+            const float radius2        = sphere.radius * sphere.radius;
+
+            const float sin2ThetaMax = radius2 / distance2;
+            const float cosTheta     = 1.f - u[0] * (sin2ThetaMax / (1.f + std::sqrt(std::max(1.f - sin2ThetaMax, 0.f))));
+            const float sinTheta     = std::sqrt(std::max(1.f - cosTheta * cosTheta, 0.f));
+            const float phi          = 2.f * PI * u[1];
+
+            float tangent[3], bitangent[3];
+            const float axis[3] = { toCenter[0] / centerDistance, toCenter[1] / centerDistance, toCenter[2] / centerDistance };
+            BuildBasis(axis, tangent, bitangent);
+
+            for (size_t c = 0u; c < 3u; c++)
+                direction[c] = sinTheta * std::cos(phi) * tangent[c] + sinTheta * std::sin(phi) * bitangent[c] + cosTheta * axis[c];
+            Normalize(direction);
+
+            const float tca = centerDistance * cosTheta;
+            distance = tca - std::sqrt(std::max(radius2 - (distance2 - tca * tca), 0.f));
+        } else {
+            const SceneTriangle& triangle = pass.pTriangles[light.primitiveIndex];
+
+            const float su = std::sqrt(u[0]);
+
+            float normal[3];
+            GetTriangleNormal(triangle, normal);
+            const float area = 0.5f * std::sqrt(normal[0] * normal[0] + normal[1] * normal[1] + normal[2] * normal[2]);
+
+            float toLight[3];
+            for (size_t c = 0u; c < 3u; c++)
+                toLight[c] = (triangle.v0[c] + triangle.edge1[c] * (su * (1.f - u[1])) + triangle.edge2[c] * (su * u[1])) - origin[c];
+
+            const float distance2 = toLight[0] * toLight[0] + toLight[1] * toLight[1] + toLight[2] * toLight[2];
+            distance = std::sqrt(distance2);
+            for (size_t c = 0u; c < 3u; c++)
+                direction[c] = toLight[c] / distance;
+
+            const float cosLight = std::abs(normal[0] * direction[0] + normal[1] * direction[1] + normal[2] * direction[2]) / (2.f * area);
+            if (!(cosLight > 0.f))
+                return false;
+
+            pdf = distance2 / (area * cosLight);
+        }
+
+        pdf *= light.probability;
+        return true;
+    }
+
+    // The Pdf Of SampleLight Picking The Point A Ray From 'origin' Hit ('normal' Is Normalized)
+    inline float LightPdf(const PassParameters& pass, const Hit& hit, const float normal[3], const float origin[3], const float d[3]) noexcept {
+        const SceneLight& light = pass.pLights[hit.lightIndex];
+
+        if (light.primitiveType == eSceneLightSphere)
+            return light.probability * SphereSolidAnglePdf(pass.pSpheres[light.primitiveIndex], origin);
+
+        float triangleNormal[3];
+        GetTriangleNormal(pass.pTriangles[light.primitiveIndex], triangleNormal);
+
+        const float area     = 0.5f * std::sqrt(triangleNormal[0] * triangleNormal[0] + triangleNormal[1] * triangleNormal[1] + triangleNormal[2] * triangleNormal[2]);
+        const float cosLight = std::abs(normal[0] * d[0] + normal[1] * d[1] + normal[2] * d[2]);
+
+        return light.probability * hit.t * hit.t / (area * cosLight);
+    }
+
+    // Written As A Ratio So That Huge Pdfs (Grazing Or Distant Lights) Don't Overflow
+    inline float PowerHeuristic(const float pdf, const float otherPdf) noexcept {
+        const float ratio = otherPdf / pdf;
+        return 1.f / (1.f + ratio * ratio);
+    }
+
+    // The State Carried Along A Path Between Bounces
+    struct PathState {
+        float throughput[3];
+        float radiance[3];
+        float bsdfPdf; // The Pdf Of The Current Direction, 0 For Camera Rays
+        float aovs[8]; // The Camera Ray's Hit: Albedo & Depth, Then The Normal (The Shader's AOVs), Zero On A Miss
+    }; // PathState
+
+    constexpr PathState CAMERA_PATH = { { 1.f, 1.f, 1.f }, { 0.f, 0.f, 0.f }, 0.f, { 0.f, 0.f, 0.f, 0.f, 0.f, 0.f, 0.f, 0.f } };
+
+    // Adds A Pass' AOVs To The Pixel's, Like The Shader's AccumulatePass
+    inline void AccumulateAovs(const PassParameters& pass, const std::uint32_t x, const std::uint32_t y, const float aovs[8]) noexcept {
+        if (pass.pAovs == nullptr)
+            return;
+
+        Colorf32* pPixelAovs = pass.pAovs + 2u * (static_cast<size_t>(y - pass.firstRow) * pass.width + x);
+        for (size_t i = 0u; i < 2u; i++) {
+            pPixelAovs[i].r += aovs[4u * i];
+            pPixelAovs[i].g += aovs[4u * i + 1u];
+            pPixelAovs[i].b += aovs[4u * i + 2u];
+            pPixelAovs[i].a += aovs[4u * i + 3u];
+        }
+    }
+
+    // The Shader's ShadeIntersection: Adds The Light Gathered At 'hit' (Emission & A Shadow Ray, Combined With MIS) & Scatters The Ray (o, d)
+    // Returns False When The Path Ends, Shared By The Scalar & Packet Tracers So That They Stay Identical
+    inline bool ShadeHit(const PassParameters& pass, Sampler& sampler, const std::uint32_t bounce, const Hit& hit,
+                         float o[3], float d[3], PathState& path, std::uint64_t& rayCount) noexcept {
+        const SceneMaterial& material = pass.pMaterials[hit.materialIndex];
+
+        float normal[3] = { hit.normal[0], hit.normal[1], hit.normal[2] };
+        Normalize(normal);
+
+        if (bounce == 0u) {
+            for (size_t c = 0u; c < 3u; c++) {
+                path.aovs[c]      = material.diffuseColor[c];
+                path.aovs[4u + c] = normal[c];
+            }
+            path.aovs[3] = hit.t;
+        }
+
+        // Emission, Weighted Against The Shadow Ray The Previous Vertex Cast
+        float weight = 1.f;
+        if (path.bsdfPdf > 0.f && hit.lightIndex != SCENE_NO_LIGHT && (material.emittance[0] != 0.f || material.emittance[1] != 0.f || material.emittance[2] != 0.f))
+            weight = PowerHeuristic(path.bsdfPdf, LightPdf(pass, hit, normal, o, d));
+
+        for (size_t c = 0u; c < 3u; c++)
+            path.radiance[c] += path.throughput[c] * (material.emittance[c] * weight);
+
+        const float* albedo = material.diffuseColor;
+        if (bounce + 1u == pass.maxIterations || (albedo[0] == 0.f && albedo[1] == 0.f && albedo[2] == 0.f))
+            return false;
+
+        float origin[3];
+        for (size_t c = 0u; c < 3u; c++)
+            origin[c] = (o[c] + hit.t * d[c]) + normal[c] * EPSILON;
+
+        // Next-Event Estimation
+        float lightSample[3];
+        SampleDimensions(pass, sampler, 1u + 2u * bounce, 3u, lightSample);
+        if (pass.lightCount > 0u) {
+            const SceneLight& light = pass.pLights[SelectLight(pass, lightSample[0])];
+
+            float direction[3], distance, lightPdf;
+            if (SampleLight(pass, light, origin, lightSample + 1, direction, distance, lightPdf)) {
+                const float cosSurface = normal[0] * direction[0] + normal[1] * direction[1] + normal[2] * direction[2];
+
+                if (cosSurface > 0.f) {
+                    rayCount++;
+
+                    if (!IsOccluded(pass, origin, direction, distance - EPSILON)) {
+                        const std::uint32_t materialIndex  = (light.primitiveType == eSceneLightSphere) ? pass.pSpheres[light.primitiveIndex].materialIndex : pass.pTriangles[light.primitiveIndex].materialIndex;
+                        const float*        lightEmittance = pass.pMaterials[materialIndex].emittance;
+                        const float         lightWeight    = PowerHeuristic(lightPdf, cosSurface / PI);
+
+                        for (size_t c = 0u; c < 3u; c++)
+                            path.radiance[c] += path.throughput[c] * albedo[c] / PI * lightEmittance[c] * (cosSurface * lightWeight / lightPdf);
+                    }
+                }
+            }
+        }
+
+        // Continue The Path
+        float directionSample[3];
+        SampleDimensions(pass, sampler, 2u + 2u * bounce, 2u, directionSample);
+
+        for (size_t c = 0u; c < 3u; c++)
+            o[c] = origin[c];
+        path.bsdfPdf = SampleCosineHemisphere(normal, directionSample, d);
+
+        for (size_t c = 0u; c < 3u; c++)
+            path.throughput[c] *= albedo[c];
+
+        return true;
+    }
+
+    // Traces One Sample (The Shader's TracePath), Adding Its Radiance To 'radiance' & Its AOVs To 'aovs'
+    inline void TraceSample(const PassParameters& pass, float o[3], float d[3], Sampler& sampler, float radiance[3], float aovs[8], std::uint64_t& rayCount) noexcept {
+        PathState path = CAMERA_PATH;
+
+        for (std::uint32_t bounce = 0u; bounce < pass.maxIterations; bounce++) {
+            rayCount++;
+
+            const Hit hit = FindClosestIntersection(pass, o, d);
+            if (hit.t == NO_HIT || !ShadeHit(pass, sampler, bounce, hit, o, d, path, rayCount))
+                break;
+        }
+
+        for (size_t c = 0u; c < 3u; c++)
+            radiance[c] += path.radiance[c];
+        for (size_t i = 0u; i < 8u; i++)
+            aovs[i] += path.aovs[i];
+    }
+
+    // All Variants Add A Pass Into The Accumulation Buffer (Row Pitch = pass.width) & Return The Number Of Rays Cast
+    using TraceTileFunction = std::uint64_t(*)(const PassParameters&, std::uint32_t, std::uint32_t, std::uint32_t, std::uint32_t, Colorf32*);
+
+    std::uint64_t TraceTileScalar(const PassParameters& pass, const std::uint32_t tileOffsetX, const std::uint32_t tileOffsetY,
+                                  const std::uint32_t tileExtentX, const std::uint32_t tileExtentY, Colorf32* pPixels) noexcept {
+        std::uint64_t rayCount = 0u;
+
+        for (std::uint32_t y = tileOffsetY; y < tileOffsetY + tileExtentY; y++) {
+            for (std::uint32_t x = tileOffsetX; x < tileOffsetX + tileExtentX; x++) {
+                float passColor[3] = { 0.f, 0.f, 0.f };
+                float passAovs[8]  = { 0.f, 0.f, 0.f, 0.f, 0.f, 0.f, 0.f, 0.f };
+                for (std::uint32_t s = 0u; s < pass.sampleCount; s++) {
+                    Sampler sampler = BeginSample(pass, x, y, s);
+
+                    float origin[3], direction[3];
+                    GenerateCameraRay(pass, x, y, sampler, origin, direction);
+
+                    TraceSample(pass, origin, direction, sampler, passColor, passAovs, rayCount);
+                }
+
+                Colorf32& pixel = pPixels[static_cast<size_t>(y - pass.firstRow) * pass.width + x];
+                pixel.r += passColor[0];
+                pixel.g += passColor[1];
+                pixel.b += passColor[2];
+                pixel.a += static_cast<float>(pass.sampleCount);
+
+                AccumulateAovs(pass, x, y, passAovs);
+            }
+        }
+
+        return rayCount;
+    }
+
+#ifdef POLAR_X86
+
+    inline std::uint32_t CountLanes(const int mask) noexcept {
+        return static_cast<std::uint32_t>(std::bitset<8>(static_cast<unsigned>(mask)).count());
+    }
+
+    // Per-Lane State Of A Packet, Laid Out For Aligned Loads
+    template <size_t N>
+    struct alignas(32) Packet {
+        float ox[N], oy[N], oz[N];
+        float dx[N], dy[N], dz[N];
+
+        // The Closest Hits, Handed To ShadeHit
+        float         t[N], nx[N], ny[N], nz[N];
+        std::uint32_t materialIndex[N], lightIndex[N];
+        std::uint32_t activeLanes[N]; // All Bits Set While The Lane's Path Is Alive
+
+        Sampler   sampler[N];
+        PathState path[N];
+    }; // Packet
+
+    // Lets Indices Be Blended Like The Float Lanes
+    inline __m128 BroadcastIndex4(const std::uint32_t index) noexcept {
+        return _mm_castsi128_ps(_mm_set1_epi32(static_cast<int>(index)));
+    }
+
+    POLAR_TARGET_AVX2 inline __m256 BroadcastIndex8(const std::uint32_t index) noexcept {
+        return _mm256_castsi256_ps(_mm256_set1_epi32(static_cast<int>(index)));
+    }
+
+    std::uint64_t TraceTileSSE(const PassParameters& pass, const std::uint32_t tileOffsetX, const std::uint32_t tileOffsetY,
+                               const std::uint32_t tileExtentX, const std::uint32_t tileExtentY, Colorf32* pPixels) noexcept {
+        constexpr std::uint32_t N = 4u;
+
+        const __m128 zero    = _mm_setzero_ps();
+        const __m128 one     = _mm_set1_ps(1.f);
+        const __m128 noHit   = _mm_set1_ps(NO_HIT);
+        const __m128 epsilon = _mm_set1_ps(EPSILON);
+
+        std::uint64_t rayCount = 0u;
+        Packet<N> packet = {};
+
+        for (std::uint32_t y = tileOffsetY; y < tileOffsetY + tileExtentY; y++) {
+            for (std::uint32_t x = tileOffsetX; x < tileOffsetX + tileExtentX; x += N) {
+                const std::uint32_t laneCount = std::min(N, tileOffsetX + tileExtentX - x);
+
+                float passColor[N][3] = {};
+                float passAovs[N][8]  = {};
+                for (std::uint32_t s = 0u; s < pass.sampleCount; s++) {
+                    for (std::uint32_t lane = 0u; lane < laneCount; lane++) {
+                        packet.sampler[lane] = BeginSample(pass, x + lane, y, s);
+                        packet.path[lane]    = CAMERA_PATH;
+
+                        float origin[3], direction[3];
+                        GenerateCameraRay(pass, x + lane, y, packet.sampler[lane], origin, direction);
+
+                        packet.ox[lane] = origin[0];    packet.oy[lane] = origin[1];    packet.oz[lane] = origin[2];
+                        packet.dx[lane] = direction[0]; packet.dy[lane] = direction[1]; packet.dz[lane] = direction[2];
+                    }
+
+                    __m128 ox = _mm_load_ps(packet.ox), oy = _mm_load_ps(packet.oy), oz = _mm_load_ps(packet.oz);
+                    __m128 dx = _mm_load_ps(packet.dx), dy = _mm_load_ps(packet.dy), dz = _mm_load_ps(packet.dz);
+
+                    __m128 active = _mm_cmplt_ps(_mm_setr_ps(0.f, 1.f, 2.f, 3.f), _mm_set1_ps(static_cast<float>(laneCount)));
+                    for (std::uint32_t bounce = 0u; bounce < pass.maxIterations; bounce++) {
+                        rayCount += CountLanes(_mm_movemask_ps(active));
+
+                        // FindClosestIntersection
+                        __m128 tBest = noHit, nx = zero, ny = zero, nz = zero; // Unnormalized Normal Of The Closest Hit
+                        __m128 materialIndex = zero, lightIndex = zero;
+                        for (std::uint32_t i = 0u; i < pass.sphereCount; i++) {
+                            const SceneSphere& sphere = pass.pSpheres[i];
+
+                            const __m128 radius2 = _mm_set1_ps(sphere.radius * sphere.radius);
+                            const __m128 Lx = _mm_sub_ps(_mm_set1_ps(sphere.center[0]), ox);
+                            const __m128 Ly = _mm_sub_ps(_mm_set1_ps(sphere.center[1]), oy);
+                            const __m128 Lz = _mm_sub_ps(_mm_set1_ps(sphere.center[2]), oz);
+                            const __m128 tca = _mm_add_ps(_mm_add_ps(_mm_mul_ps(Lx, dx), _mm_mul_ps(Ly, dy)), _mm_mul_ps(Lz, dz));
+                            const __m128 d2  = _mm_sub_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(Lx, Lx), _mm_mul_ps(Ly, Ly)), _mm_mul_ps(Lz, Lz)), _mm_mul_ps(tca, tca));
+                            const __m128 thc = _mm_sqrt_ps(_mm_max_ps(_mm_sub_ps(radius2, d2), zero));
+                            const __m128 t0  = _mm_sub_ps(tca, thc);
+                            const __m128 t1  = _mm_add_ps(tca, thc);
+
+                            // The Near Hit, Or The Far One When The Origin Is (Nearly) On/Inside The Sphere
+                            const __m128 useFar = _mm_cmplt_ps(t0, epsilon);
+                            const __m128 t      = _mm_or_ps(_mm_and_ps(useFar, t1), _mm_andnot_ps(useFar, t0));
+                            const __m128 closer = _mm_and_ps(_mm_and_ps(_mm_cmpngt_ps(d2, radius2), _mm_cmpge_ps(t, zero)), _mm_cmplt_ps(t, tBest));
+
+                            tBest = _mm_or_ps(_mm_and_ps(closer, t), _mm_andnot_ps(closer, tBest));
+                            nx    = _mm_or_ps(_mm_and_ps(closer, _mm_sub_ps(_mm_add_ps(ox, _mm_mul_ps(t, dx)), _mm_set1_ps(sphere.center[0]))), _mm_andnot_ps(closer, nx));
+                            ny    = _mm_or_ps(_mm_and_ps(closer, _mm_sub_ps(_mm_add_ps(oy, _mm_mul_ps(t, dy)), _mm_set1_ps(sphere.center[1]))), _mm_andnot_ps(closer, ny));
+                            nz    = _mm_or_ps(_mm_and_ps(closer, _mm_sub_ps(_mm_add_ps(oz, _mm_mul_ps(t, dz)), _mm_set1_ps(sphere.center[2]))), _mm_andnot_ps(closer, nz));
+                            materialIndex = _mm_or_ps(_mm_and_ps(closer, BroadcastIndex4(sphere.materialIndex)), _mm_andnot_ps(closer, materialIndex));
+                            lightIndex    = _mm_or_ps(_mm_and_ps(closer, BroadcastIndex4(sphere.lightIndex)), _mm_andnot_ps(closer, lightIndex));
+                        }
+
+                        for (std::uint32_t i = 0u; i < pass.planeCount; i++) {
+                            const ScenePlane& plane = pass.pPlanes[i];
+
+                            const __m128 px = _mm_set1_ps(plane.normal[0]), py = _mm_set1_ps(plane.normal[1]), pz = _mm_set1_ps(plane.normal[2]);
+                            const __m128 denominator = _mm_add_ps(_mm_add_ps(_mm_mul_ps(px, dx), _mm_mul_ps(py, dy)), _mm_mul_ps(pz, dz));
+                            const __m128 t = _mm_div_ps(_mm_add_ps(_mm_add_ps(
+                                _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(plane.point[0]), ox), px),
+                                _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(plane.point[1]), oy), py)),
+                                _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(plane.point[2]), oz), pz)), denominator);
+
+                            const __m128 absDenominator = _mm_andnot_ps(_mm_set1_ps(-0.f), denominator);
+                            const __m128 closer = _mm_and_ps(_mm_and_ps(_mm_cmpge_ps(absDenominator, _mm_set1_ps(PARALLEL_EPSILON)), _mm_cmpge_ps(t, epsilon)), _mm_cmplt_ps(t, tBest));
+
+                            // Facing The Incoming Ray: Flip The Normal When The Denominator Is Positive
+                            const __m128 flip = _mm_and_ps(_mm_cmplt_ps(zero, denominator), _mm_set1_ps(-0.f));
+
+                            tBest = _mm_or_ps(_mm_and_ps(closer, t), _mm_andnot_ps(closer, tBest));
+                            nx    = _mm_or_ps(_mm_and_ps(closer, _mm_xor_ps(px, flip)), _mm_andnot_ps(closer, nx));
+                            ny    = _mm_or_ps(_mm_and_ps(closer, _mm_xor_ps(py, flip)), _mm_andnot_ps(closer, ny));
+                            nz    = _mm_or_ps(_mm_and_ps(closer, _mm_xor_ps(pz, flip)), _mm_andnot_ps(closer, nz));
+                            materialIndex = _mm_or_ps(_mm_and_ps(closer, BroadcastIndex4(plane.materialIndex)), _mm_andnot_ps(closer, materialIndex));
+                            lightIndex    = _mm_or_ps(_mm_and_ps(closer, BroadcastIndex4(SCENE_NO_LIGHT)), _mm_andnot_ps(closer, lightIndex));
+                        }
+
+                        // Packet Walk Of The Threaded BVH: A Node Is Entered When Any Active Lane Hits Its Bounds
+                        const __m128 idx = _mm_div_ps(one, dx), idy = _mm_div_ps(one, dy), idz = _mm_div_ps(one, dz);
+                        for (std::uint32_t nodeIndex = 0u; nodeIndex < pass.bvhNodeCount; ) {
+                            const SceneBvhNode& node = pass.pBvhNodes[nodeIndex];
+
+                            const __m128 tx0 = _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(node.boundsMin[0]), ox), idx);
+                            const __m128 ty0 = _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(node.boundsMin[1]), oy), idy);
+                            const __m128 tz0 = _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(node.boundsMin[2]), oz), idz);
+                            const __m128 tx1 = _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(node.boundsMax[0]), ox), idx);
+                            const __m128 ty1 = _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(node.boundsMax[1]), oy), idy);
+                            const __m128 tz1 = _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(node.boundsMax[2]), oz), idz);
+
+                            const __m128 tNear = _mm_max_ps(_mm_max_ps(_mm_min_ps(tx0, tx1), _mm_min_ps(ty0, ty1)), _mm_max_ps(_mm_min_ps(tz0, tz1), zero));
+                            const __m128 tFar  = _mm_min_ps(_mm_min_ps(_mm_max_ps(tx0, tx1), _mm_max_ps(ty0, ty1)), _mm_min_ps(_mm_max_ps(tz0, tz1), tBest));
+
+                            if (!_mm_movemask_ps(_mm_and_ps(active, _mm_cmple_ps(tNear, tFar)))) {
+                                nodeIndex = node.primitiveCount ? nodeIndex + 1u : node.index;
+                                continue;
+                            }
+
+                            for (std::uint32_t i = node.index; i < node.index + node.primitiveCount; i++) {
+                                const SceneTriangle& triangle = pass.pTriangles[i];
+
+                                const __m128 e1x = _mm_set1_ps(triangle.edge1[0]), e1y = _mm_set1_ps(triangle.edge1[1]), e1z = _mm_set1_ps(triangle.edge1[2]);
+                                const __m128 e2x = _mm_set1_ps(triangle.edge2[0]), e2y = _mm_set1_ps(triangle.edge2[1]), e2z = _mm_set1_ps(triangle.edge2[2]);
+
+                                const __m128 px  = _mm_sub_ps(_mm_mul_ps(dy, e2z), _mm_mul_ps(dz, e2y));
+                                const __m128 py  = _mm_sub_ps(_mm_mul_ps(dz, e2x), _mm_mul_ps(dx, e2z));
+                                const __m128 pz  = _mm_sub_ps(_mm_mul_ps(dx, e2y), _mm_mul_ps(dy, e2x));
+                                const __m128 det = _mm_add_ps(_mm_add_ps(_mm_mul_ps(e1x, px), _mm_mul_ps(e1y, py)), _mm_mul_ps(e1z, pz));
+                                const __m128 inverseDet = _mm_div_ps(one, det);
+
+                                const __m128 tvx = _mm_sub_ps(ox, _mm_set1_ps(triangle.v0[0]));
+                                const __m128 tvy = _mm_sub_ps(oy, _mm_set1_ps(triangle.v0[1]));
+                                const __m128 tvz = _mm_sub_ps(oz, _mm_set1_ps(triangle.v0[2]));
+                                const __m128 u   = _mm_mul_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(tvx, px), _mm_mul_ps(tvy, py)), _mm_mul_ps(tvz, pz)), inverseDet);
+
+                                const __m128 qx = _mm_sub_ps(_mm_mul_ps(tvy, e1z), _mm_mul_ps(tvz, e1y));
+                                const __m128 qy = _mm_sub_ps(_mm_mul_ps(tvz, e1x), _mm_mul_ps(tvx, e1z));
+                                const __m128 qz = _mm_sub_ps(_mm_mul_ps(tvx, e1y), _mm_mul_ps(tvy, e1x));
+                                const __m128 v  = _mm_mul_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, qx), _mm_mul_ps(dy, qy)), _mm_mul_ps(dz, qz)), inverseDet);
+                                const __m128 t  = _mm_mul_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(e2x, qx), _mm_mul_ps(e2y, qy)), _mm_mul_ps(e2z, qz)), inverseDet);
+
+                                const __m128 inside = _mm_and_ps(_mm_and_ps(_mm_cmpge_ps(u, zero), _mm_cmpge_ps(v, zero)), _mm_cmple_ps(_mm_add_ps(u, v), one));
+                                const __m128 closer = _mm_and_ps(_mm_and_ps(_mm_cmpneq_ps(det, zero), inside), _mm_and_ps(_mm_cmpge_ps(t, epsilon), _mm_cmplt_ps(t, tBest)));
+
+                                float normal[3];
+                                GetTriangleNormal(triangle, normal);
+
+                                // Facing The Incoming Ray: Flip The Normal When It Points Along The Ray
+                                const __m128 gx = _mm_set1_ps(normal[0]), gy = _mm_set1_ps(normal[1]), gz = _mm_set1_ps(normal[2]);
+                                const __m128 facing = _mm_add_ps(_mm_add_ps(_mm_mul_ps(gx, dx), _mm_mul_ps(gy, dy)), _mm_mul_ps(gz, dz));
+                                const __m128 flip   = _mm_and_ps(_mm_cmplt_ps(zero, facing), _mm_set1_ps(-0.f));
+
+                                tBest = _mm_or_ps(_mm_and_ps(closer, t), _mm_andnot_ps(closer, tBest));
+                                nx    = _mm_or_ps(_mm_and_ps(closer, _mm_xor_ps(gx, flip)), _mm_andnot_ps(closer, nx));
+                                ny    = _mm_or_ps(_mm_and_ps(closer, _mm_xor_ps(gy, flip)), _mm_andnot_ps(closer, ny));
+                                nz    = _mm_or_ps(_mm_and_ps(closer, _mm_xor_ps(gz, flip)), _mm_andnot_ps(closer, nz));
+                                materialIndex = _mm_or_ps(_mm_and_ps(closer, BroadcastIndex4(triangle.materialIndex)), _mm_andnot_ps(closer, materialIndex));
+                                lightIndex    = _mm_or_ps(_mm_and_ps(closer, BroadcastIndex4(triangle.lightIndex)), _mm_andnot_ps(closer, lightIndex));
+                            }
+
+                            nodeIndex++;
+                        }
+
+                        // Lanes That Missed Are Done
+                        active = _mm_and_ps(active, _mm_cmplt_ps(tBest, noHit));
+
+                        const int activeMask = _mm_movemask_ps(active);
+                        if (!activeMask)
+                            break;
+
+                        // Shade Every Lane That Hit With The Scalar Code, So That Packets Trace Exactly What TraceSample Does
+                        _mm_store_ps(packet.t, tBest);
+                        _mm_store_ps(packet.nx, nx);
+                        _mm_store_ps(packet.ny, ny);
+                        _mm_store_ps(packet.nz, nz);
+                        _mm_store_si128(reinterpret_cast<__m128i*>(packet.materialIndex), _mm_castps_si128(materialIndex));
+                        _mm_store_si128(reinterpret_cast<__m128i*>(packet.lightIndex),    _mm_castps_si128(lightIndex));
+                        _mm_store_si128(reinterpret_cast<__m128i*>(packet.activeLanes),   _mm_castps_si128(active));
+
+                        for (std::uint32_t lane = 0u; lane < N; lane++) {
+                            if (!(activeMask & (1 << lane)))
+                                continue;
+
+                            float o[3] = { packet.ox[lane], packet.oy[lane], packet.oz[lane] };
+                            float d[3] = { packet.dx[lane], packet.dy[lane], packet.dz[lane] };
+                            const Hit hit = { packet.t[lane], { packet.nx[lane], packet.ny[lane], packet.nz[lane] }, packet.materialIndex[lane], packet.lightIndex[lane] };
+
+                            if (!ShadeHit(pass, packet.sampler[lane], bounce, hit, o, d, packet.path[lane], rayCount))
+                                packet.activeLanes[lane] = 0u;
+
+                            packet.ox[lane] = o[0]; packet.oy[lane] = o[1]; packet.oz[lane] = o[2];
+                            packet.dx[lane] = d[0]; packet.dy[lane] = d[1]; packet.dz[lane] = d[2];
+                        }
+
+                        active = _mm_castsi128_ps(_mm_load_si128(reinterpret_cast<const __m128i*>(packet.activeLanes)));
+                        ox = _mm_load_ps(packet.ox); oy = _mm_load_ps(packet.oy); oz = _mm_load_ps(packet.oz);
+                        dx = _mm_load_ps(packet.dx); dy = _mm_load_ps(packet.dy); dz = _mm_load_ps(packet.dz);
+                    }
+
+
+                    for (std::uint32_t lane = 0u; lane < laneCount; lane++) {
+                        for (size_t c = 0u; c < 3u; c++)
+                            passColor[lane][c] += packet.path[lane].radiance[c];
+                        for (size_t i = 0u; i < 8u; i++)
+                            passAovs[lane][i] += packet.path[lane].aovs[i];
+                    }
+                }
+
+                for (std::uint32_t lane = 0u; lane < laneCount; lane++) {
+                    Colorf32& pixel = pPixels[static_cast<size_t>(y - pass.firstRow) * pass.width + x + lane];
+                    pixel.r += passColor[lane][0];
+                    pixel.g += passColor[lane][1];
+                    pixel.b += passColor[lane][2];
+                    pixel.a += static_cast<float>(pass.sampleCount);
+
+                    AccumulateAovs(pass, x + lane, y, passAovs[lane]);
+                }
+            }
+        }
+
+        return rayCount;
+    }
+
+    POLAR_TARGET_AVX2 std::uint64_t TraceTileAVX2(const PassParameters& pass, const std::uint32_t tileOffsetX, const std::uint32_t tileOffsetY,
+                                                 const std::uint32_t tileExtentX, const std::uint32_t tileExtentY, Colorf32* pPixels) noexcept {
+        constexpr std::uint32_t N = 8u;
+
+        const __m256 zero    = _mm256_setzero_ps();
+        const __m256 one     = _mm256_set1_ps(1.f);
+        const __m256 noHit   = _mm256_set1_ps(NO_HIT);
+        const __m256 epsilon = _mm256_set1_ps(EPSILON);
+
+        std::uint64_t rayCount = 0u;
+        Packet<N> packet = {};
+
+        for (std::uint32_t y = tileOffsetY; y < tileOffsetY + tileExtentY; y++) {
+            for (std::uint32_t x = tileOffsetX; x < tileOffsetX + tileExtentX; x += N) {
+                const std::uint32_t laneCount = std::min(N, tileOffsetX + tileExtentX - x);
+
+                float passColor[N][3] = {};
+                float passAovs[N][8]  = {};
+                for (std::uint32_t s = 0u; s < pass.sampleCount; s++) {
+                    for (std::uint32_t lane = 0u; lane < laneCount; lane++) {
+                        packet.sampler[lane] = BeginSample(pass, x + lane, y, s);
+                        packet.path[lane]    = CAMERA_PATH;
+
+                        float origin[3], direction[3];
+                        GenerateCameraRay(pass, x + lane, y, packet.sampler[lane], origin, direction);
+
+                        packet.ox[lane] = origin[0];    packet.oy[lane] = origin[1];    packet.oz[lane] = origin[2];
+                        packet.dx[lane] = direction[0]; packet.dy[lane] = direction[1]; packet.dz[lane] = direction[2];
+                    }
+
+                    __m256 ox = _mm256_load_ps(packet.ox), oy = _mm256_load_ps(packet.oy), oz = _mm256_load_ps(packet.oz);
+                    __m256 dx = _mm256_load_ps(packet.dx), dy = _mm256_load_ps(packet.dy), dz = _mm256_load_ps(packet.dz);
+
+                    __m256 active = _mm256_cmp_ps(_mm256_setr_ps(0.f, 1.f, 2.f, 3.f, 4.f, 5.f, 6.f, 7.f), _mm256_set1_ps(static_cast<float>(laneCount)), _CMP_LT_OQ);
+                    for (std::uint32_t bounce = 0u; bounce < pass.maxIterations; bounce++) {
+                        rayCount += CountLanes(_mm256_movemask_ps(active));
+
+                        // FindClosestIntersection
+                        __m256 tBest = noHit, nx = zero, ny = zero, nz = zero; // Unnormalized Normal Of The Closest Hit
+                        __m256 materialIndex = zero, lightIndex = zero;
+                        for (std::uint32_t i = 0u; i < pass.sphereCount; i++) {
+                            const SceneSphere& sphere = pass.pSpheres[i];
+
+                            const __m256 radius2 = _mm256_set1_ps(sphere.radius * sphere.radius);
+                            const __m256 Lx = _mm256_sub_ps(_mm256_set1_ps(sphere.center[0]), ox);
+                            const __m256 Ly = _mm256_sub_ps(_mm256_set1_ps(sphere.center[1]), oy);
+                            const __m256 Lz = _mm256_sub_ps(_mm256_set1_ps(sphere.center[2]), oz);
+                            const __m256 tca = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(Lx, dx), _mm256_mul_ps(Ly, dy)), _mm256_mul_ps(Lz, dz));
+                            const __m256 d2  = _mm256_sub_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(Lx, Lx), _mm256_mul_ps(Ly, Ly)), _mm256_mul_ps(Lz, Lz)), _mm256_mul_ps(tca, tca));
+                            const __m256 thc = _mm256_sqrt_ps(_mm256_max_ps(_mm256_sub_ps(radius2, d2), zero));
+                            const __m256 t0  = _mm256_sub_ps(tca, thc);
+                            const __m256 t1  = _mm256_add_ps(tca, thc);
+
+                            // The Near Hit, Or The Far One When The Origin Is (Nearly) On/Inside The Sphere
+                            const __m256 useFar = _mm256_cmp_ps(t0, epsilon, _CMP_LT_OQ);
+                            const __m256 t      = _mm256_or_ps(_mm256_and_ps(useFar, t1), _mm256_andnot_ps(useFar, t0));
+                            const __m256 closer = _mm256_and_ps(_mm256_and_ps(_mm256_cmp_ps(d2, radius2, _CMP_NGT_UQ), _mm256_cmp_ps(t, zero, _CMP_GE_OQ)), _mm256_cmp_ps(t, tBest, _CMP_LT_OQ));
+
+                            tBest = _mm256_or_ps(_mm256_and_ps(closer, t), _mm256_andnot_ps(closer, tBest));
+                            nx    = _mm256_or_ps(_mm256_and_ps(closer, _mm256_sub_ps(_mm256_add_ps(ox, _mm256_mul_ps(t, dx)), _mm256_set1_ps(sphere.center[0]))), _mm256_andnot_ps(closer, nx));
+                            ny    = _mm256_or_ps(_mm256_and_ps(closer, _mm256_sub_ps(_mm256_add_ps(oy, _mm256_mul_ps(t, dy)), _mm256_set1_ps(sphere.center[1]))), _mm256_andnot_ps(closer, ny));
+                            nz    = _mm256_or_ps(_mm256_and_ps(closer, _mm256_sub_ps(_mm256_add_ps(oz, _mm256_mul_ps(t, dz)), _mm256_set1_ps(sphere.center[2]))), _mm256_andnot_ps(closer, nz));
+                            materialIndex = _mm256_or_ps(_mm256_and_ps(closer, BroadcastIndex8(sphere.materialIndex)), _mm256_andnot_ps(closer, materialIndex));
+                            lightIndex    = _mm256_or_ps(_mm256_and_ps(closer, BroadcastIndex8(sphere.lightIndex)), _mm256_andnot_ps(closer, lightIndex));
+                        }
+
+                        for (std::uint32_t i = 0u; i < pass.planeCount; i++) {
+                            const ScenePlane& plane = pass.pPlanes[i];
+
+                            const __m256 px = _mm256_set1_ps(plane.normal[0]), py = _mm256_set1_ps(plane.normal[1]), pz = _mm256_set1_ps(plane.normal[2]);
+                            const __m256 denominator = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(px, dx), _mm256_mul_ps(py, dy)), _mm256_mul_ps(pz, dz));
+                            const __m256 t = _mm256_div_ps(_mm256_add_ps(_mm256_add_ps(
+                                _mm256_mul_ps(_mm256_sub_ps(_mm256_set1_ps(plane.point[0]), ox), px),
+                                _mm256_mul_ps(_mm256_sub_ps(_mm256_set1_ps(plane.point[1]), oy), py)),
+                                _mm256_mul_ps(_mm256_sub_ps(_mm256_set1_ps(plane.point[2]), oz), pz)), denominator);
+
+                            const __m256 absDenominator = _mm256_andnot_ps(_mm256_set1_ps(-0.f), denominator);
+                            const __m256 closer = _mm256_and_ps(_mm256_and_ps(_mm256_cmp_ps(absDenominator, _mm256_set1_ps(PARALLEL_EPSILON), _CMP_GE_OQ), _mm256_cmp_ps(t, epsilon, _CMP_GE_OQ)), _mm256_cmp_ps(t, tBest, _CMP_LT_OQ));
+
+                            // Facing The Incoming Ray: Flip The Normal When The Denominator Is Positive
+                            const __m256 flip = _mm256_and_ps(_mm256_cmp_ps(zero, denominator, _CMP_LT_OQ), _mm256_set1_ps(-0.f));
+
+                            tBest = _mm256_or_ps(_mm256_and_ps(closer, t), _mm256_andnot_ps(closer, tBest));
+                            nx    = _mm256_or_ps(_mm256_and_ps(closer, _mm256_xor_ps(px, flip)), _mm256_andnot_ps(closer, nx));
+                            ny    = _mm256_or_ps(_mm256_and_ps(closer, _mm256_xor_ps(py, flip)), _mm256_andnot_ps(closer, ny));
+                            nz    = _mm256_or_ps(_mm256_and_ps(closer, _mm256_xor_ps(pz, flip)), _mm256_andnot_ps(closer, nz));
+                            materialIndex = _mm256_or_ps(_mm256_and_ps(closer, BroadcastIndex8(plane.materialIndex)), _mm256_andnot_ps(closer, materialIndex));
+                            lightIndex    = _mm256_or_ps(_mm256_and_ps(closer, BroadcastIndex8(SCENE_NO_LIGHT)), _mm256_andnot_ps(closer, lightIndex));
+                        }
+
+                        // Packet Walk Of The Threaded BVH: A Node Is Entered When Any Active Lane Hits Its Bounds
+                        const __m256 idx = _mm256_div_ps(one, dx), idy = _mm256_div_ps(one, dy), idz = _mm256_div_ps(one, dz);
+                        for (std::uint32_t nodeIndex = 0u; nodeIndex < pass.bvhNodeCount; ) {
+                            const SceneBvhNode& node = pass.pBvhNodes[nodeIndex];
+
+                            const __m256 tx0 = _mm256_mul_ps(_mm256_sub_ps(_mm256_set1_ps(node.boundsMin[0]), ox), idx);
+                            const __m256 ty0 = _mm256_mul_ps(_mm256_sub_ps(_mm256_set1_ps(node.boundsMin[1]), oy), idy);
+                            const __m256 tz0 = _mm256_mul_ps(_mm256_sub_ps(_mm256_set1_ps(node.boundsMin[2]), oz), idz);
+                            const __m256 tx1 = _mm256_mul_ps(_mm256_sub_ps(_mm256_set1_ps(node.boundsMax[0]), ox), idx);
+                            const __m256 ty1 = _mm256_mul_ps(_mm256_sub_ps(_mm256_set1_ps(node.boundsMax[1]), oy), idy);
+                            const __m256 tz1 = _mm256_mul_ps(_mm256_sub_ps(_mm256_set1_ps(node.boundsMax[2]), oz), idz);
+
+                            const __m256 tNear = _mm256_max_ps(_mm256_max_ps(_mm256_min_ps(tx0, tx1), _mm256_min_ps(ty0, ty1)), _mm256_max_ps(_mm256_min_ps(tz0, tz1), zero));
+                            const __m256 tFar  = _mm256_min_ps(_mm256_min_ps(_mm256_max_ps(tx0, tx1), _mm256_max_ps(ty0, ty1)), _mm256_min_ps(_mm256_max_ps(tz0, tz1), tBest));
+
+                            if (!_mm256_movemask_ps(_mm256_and_ps(active, _mm256_cmp_ps(tNear, tFar, _CMP_LE_OQ)))) {
+                                nodeIndex = node.primitiveCount ? nodeIndex + 1u : node.index;
+                                continue;
+                            }
+
+                            for (std::uint32_t i = node.index; i < node.index + node.primitiveCount; i++) {
+                                const SceneTriangle& triangle = pass.pTriangles[i];
+
+                                const __m256 e1x = _mm256_set1_ps(triangle.edge1[0]), e1y = _mm256_set1_ps(triangle.edge1[1]), e1z = _mm256_set1_ps(triangle.edge1[2]);
+                                const __m256 e2x = _mm256_set1_ps(triangle.edge2[0]), e2y = _mm256_set1_ps(triangle.edge2[1]), e2z = _mm256_set1_ps(triangle.edge2[2]);
+
+                                const __m256 px  = _mm256_sub_ps(_mm256_mul_ps(dy, e2z), _mm256_mul_ps(dz, e2y));
+                                const __m256 py  = _mm256_sub_ps(_mm256_mul_ps(dz, e2x), _mm256_mul_ps(dx, e2z));
+                                const __m256 pz  = _mm256_sub_ps(_mm256_mul_ps(dx, e2y), _mm256_mul_ps(dy, e2x));
+                                const __m256 det = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(e1x, px), _mm256_mul_ps(e1y, py)), _mm256_mul_ps(e1z, pz));
+                                const __m256 inverseDet = _mm256_div_ps(one, det);
+
+                                const __m256 tvx = _mm256_sub_ps(ox, _mm256_set1_ps(triangle.v0[0]));
+                                const __m256 tvy = _mm256_sub_ps(oy, _mm256_set1_ps(triangle.v0[1]));
+                                const __m256 tvz = _mm256_sub_ps(oz, _mm256_set1_ps(triangle.v0[2]));
+                                const __m256 u   = _mm256_mul_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(tvx, px), _mm256_mul_ps(tvy, py)), _mm256_mul_ps(tvz, pz)), inverseDet);
+
+                                const __m256 qx = _mm256_sub_ps(_mm256_mul_ps(tvy, e1z), _mm256_mul_ps(tvz, e1y));
+                                const __m256 qy = _mm256_sub_ps(_mm256_mul_ps(tvz, e1x), _mm256_mul_ps(tvx, e1z));
+                                const __m256 qz = _mm256_sub_ps(_mm256_mul_ps(tvx, e1y), _mm256_mul_ps(tvy, e1x));
+                                const __m256 v  = _mm256_mul_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(dx, qx), _mm256_mul_ps(dy, qy)), _mm256_mul_ps(dz, qz)), inverseDet);
+                                const __m256 t  = _mm256_mul_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(e2x, qx), _mm256_mul_ps(e2y, qy)), _mm256_mul_ps(e2z, qz)), inverseDet);
+
+                                const __m256 inside = _mm256_and_ps(_mm256_and_ps(_mm256_cmp_ps(u, zero, _CMP_GE_OQ), _mm256_cmp_ps(v, zero, _CMP_GE_OQ)), _mm256_cmp_ps(_mm256_add_ps(u, v), one, _CMP_LE_OQ));
+                                const __m256 closer = _mm256_and_ps(_mm256_and_ps(_mm256_cmp_ps(det, zero, _CMP_NEQ_OQ), inside), _mm256_and_ps(_mm256_cmp_ps(t, epsilon, _CMP_GE_OQ), _mm256_cmp_ps(t, tBest, _CMP_LT_OQ)));
+
+                                float normal[3];
+                                GetTriangleNormal(triangle, normal);
+
+                                // Facing The Incoming Ray: Flip The Normal When It Points Along The Ray
+                                const __m256 gx = _mm256_set1_ps(normal[0]), gy = _mm256_set1_ps(normal[1]), gz = _mm256_set1_ps(normal[2]);
+                                const __m256 facing = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(gx, dx), _mm256_mul_ps(gy, dy)), _mm256_mul_ps(gz, dz));
+                                const __m256 flip   = _mm256_and_ps(_mm256_cmp_ps(zero, facing, _CMP_LT_OQ), _mm256_set1_ps(-0.f));
+
+                                tBest = _mm256_or_ps(_mm256_and_ps(closer, t), _mm256_andnot_ps(closer, tBest));
+                                nx    = _mm256_or_ps(_mm256_and_ps(closer, _mm256_xor_ps(gx, flip)), _mm256_andnot_ps(closer, nx));
+                                ny    = _mm256_or_ps(_mm256_and_ps(closer, _mm256_xor_ps(gy, flip)), _mm256_andnot_ps(closer, ny));
+                                nz    = _mm256_or_ps(_mm256_and_ps(closer, _mm256_xor_ps(gz, flip)), _mm256_andnot_ps(closer, nz));
+                                materialIndex = _mm256_or_ps(_mm256_and_ps(closer, BroadcastIndex8(triangle.materialIndex)), _mm256_andnot_ps(closer, materialIndex));
+                                lightIndex    = _mm256_or_ps(_mm256_and_ps(closer, BroadcastIndex8(triangle.lightIndex)), _mm256_andnot_ps(closer, lightIndex));
+                            }
+
+                            nodeIndex++;
+                        }
+
+                        // Lanes That Missed Are Done
+                        active = _mm256_and_ps(active, _mm256_cmp_ps(tBest, noHit, _CMP_LT_OQ));
+
+                        const int activeMask = _mm256_movemask_ps(active);
+                        if (!activeMask)
+                            break;
+
+                        // Shade Every Lane That Hit With The Scalar Code, So That Packets Trace Exactly What TraceSample Does
+                        _mm256_store_ps(packet.t, tBest);
+                        _mm256_store_ps(packet.nx, nx);
+                        _mm256_store_ps(packet.ny, ny);
+                        _mm256_store_ps(packet.nz, nz);
+                        _mm256_store_si256(reinterpret_cast<__m256i*>(packet.materialIndex), _mm256_castps_si256(materialIndex));
+                        _mm256_store_si256(reinterpret_cast<__m256i*>(packet.lightIndex),    _mm256_castps_si256(lightIndex));
+                        _mm256_store_si256(reinterpret_cast<__m256i*>(packet.activeLanes),   _mm256_castps_si256(active));
+
+                        for (std::uint32_t lane = 0u; lane < N; lane++) {
+                            if (!(activeMask & (1 << lane)))
+                                continue;
+
+                            float o[3] = { packet.ox[lane], packet.oy[lane], packet.oz[lane] };
+                            float d[3] = { packet.dx[lane], packet.dy[lane], packet.dz[lane] };
+                            const Hit hit = { packet.t[lane], { packet.nx[lane], packet.ny[lane], packet.nz[lane] }, packet.materialIndex[lane], packet.lightIndex[lane] };
+
+                            if (!ShadeHit(pass, packet.sampler[lane], bounce, hit, o, d, packet.path[lane], rayCount))
+                                packet.activeLanes[lane] = 0u;
+
+                            packet.ox[lane] = o[0]; packet.oy[lane] = o[1]; packet.oz[lane] = o[2];
+                            packet.dx[lane] = d[0]; packet.dy[lane] = d[1]; packet.dz[lane] = d[2];
+                        }
+
+                        active = _mm256_castsi256_ps(_mm256_load_si256(reinterpret_cast<const __m256i*>(packet.activeLanes)));
+                        ox = _mm256_load_ps(packet.ox); oy = _mm256_load_ps(packet.oy); oz = _mm256_load_ps(packet.oz);
+                        dx = _mm256_load_ps(packet.dx); dy = _mm256_load_ps(packet.dy); dz = _mm256_load_ps(packet.dz);
+                    }
+
+
+                    for (std::uint32_t lane = 0u; lane < laneCount; lane++) {
+                        for (size_t c = 0u; c < 3u; c++)
+                            passColor[lane][c] += packet.path[lane].radiance[c];
+                        for (size_t i = 0u; i < 8u; i++)
+                            passAovs[lane][i] += packet.path[lane].aovs[i];
+                    }
+                }
+
+                for (std::uint32_t lane = 0u; lane < laneCount; lane++) {
+                    Colorf32& pixel = pPixels[static_cast<size_t>(y - pass.firstRow) * pass.width + x + lane];
+                    pixel.r += passColor[lane][0];
+                    pixel.g += passColor[lane][1];
+                    pixel.b += passColor[lane][2];
+                    pixel.a += static_cast<float>(pass.sampleCount);
+
+                    AccumulateAovs(pass, x + lane, y, passAovs[lane]);
+                }
+            }
+        }
+
+        return rayCount;
+    }
+
+#endif // POLAR_X86
+
+}; // namespace CpuTracer
+
+// The Widest Packets The CPU Supports
+CpuTracer::TraceTileFunction SelectCpuTraceTile(const char*& pPacketDescription) noexcept {
+#ifdef POLAR_X86
+    const bool bAVX2 = Resolve::CpuSupportsAVX2();
+    pPacketDescription = bAVX2 ? "AVX2 8-Wide" : "SSE 4-Wide";
+    return bAVX2 ? CpuTracer::TraceTileAVX2 : CpuTracer::TraceTileSSE;
+#else
+    pPacketDescription = "Scalar";
+    return CpuTracer::TraceTileScalar;
+#endif
+}
+
+// Adds One Pass Over Every Tile Of The Pass' Rows Into 'pAccumulation', Spread Over All Cores, & Returns The Number Of Rays Cast
+std::uint64_t TraceCpuPass(const CpuTracer::PassParameters& pass, const CpuTracer::TraceTileFunction traceTile, const std::uint32_t tileSize, Colorf32* pAccumulation) {
+    const std::uint32_t tileCountX = (pass.width    + tileSize - 1u) / tileSize;
+    const std::uint32_t tileCountY = (pass.rowCount + tileSize - 1u) / tileSize;
+    const std::uint32_t endRow     = pass.firstRow + pass.rowCount;
+
+    std::atomic<std::uint64_t> rayCount{ 0u };
+    ParallelForWorkStealing(static_cast<size_t>(tileCountX) * tileCountY, [&](const size_t tile) {
+        const std::uint32_t tileOffsetX = static_cast<std::uint32_t>(tile % tileCountX) * tileSize;
+        const std::uint32_t tileOffsetY = pass.firstRow + static_cast<std::uint32_t>(tile / tileCountX) * tileSize;
+
+        rayCount += traceTile(pass, tileOffsetX, tileOffsetY, std::min(tileSize, pass.width - tileOffsetX), std::min(tileSize, endRow - tileOffsetY), pAccumulation);
+    });
+
+    return rayCount;
+}
+
+// Renders Every Frame On The Host Into The Same Accumulation Layout As The GPU
+// Used On Machines Without A GPU & As A Reference For The GPU's Output
+// Out Of Core, A Frame Is Rendered One Band (A Row Of Tiles) At A Time, Each Band Being Resolved & Streamed To The Output Before The Next
+void RunCpuBackend(const CommandLineArguments& commandLineArguments, const Scene& scene, const std::vector<Camera>& cameras, Profiler& profiler) {
+    const std::uint32_t width  = commandLineArguments.surfaceWidth;
+    const std::uint32_t height = commandLineArguments.surfaceHeight;
+
+    const std::uint32_t bandHeight = commandLineArguments.bOutOfCore ? std::min(commandLineArguments.tileSize, height) : height;
+    const std::uint32_t bandCount  = (height + bandHeight - 1u) / bandHeight;
+
+    const char*                        pPacketDescription = nullptr;
+    const CpuTracer::TraceTileFunction traceTile          = SelectCpuTraceTile(pPacketDescription);
+
+    std::printf("CPU Backend: %u Threads, %s Ray Packets\n", std::max(1u, std::thread::hardware_concurrency()), pPacketDescription);
+
+    // The Packets Trace Runs Of Adjacent Pixels, Which A Per-Pixel Mask Would Break Up
+    if (commandLineArguments.adaptiveThreshold > 0.f)
+        std::printf("Adaptive Sampling Is Only Implemented On The GPU, Every Pixel Gets %u Samples\n", commandLineArguments.samplesPerPixel);
+
+    std::vector<Colorf32> accumulation(static_cast<size_t>(width) * bandHeight);
+    std::vector<Colorf32> aovs(commandLineArguments.bAovs ? (2u * accumulation.size()) : 0u);
+
+    std::vector<Coloru8> resolvedBand(commandLineArguments.bOutOfCore ? accumulation.size() : 0u);
+    FrameStreamer        frameStreamer(width, height, commandLineArguments.outputFormat);
+
+    Checkpointer checkpointer(commandLineArguments, scene, cameras.front());
+
+    Profiler::Counters profileCounters;
+    std::uint64_t      rayCount = 0u;
+
+    const auto batchStart = std::chrono::steady_clock::now();
+    {
+        const ProfileScope renderProfileScope(profiler, "Render");
+
+        for (std::uint32_t frameIndex = 0u; frameIndex < commandLineArguments.frameCount; frameIndex++) {
+            const ProfileScope frameProfileScope(profiler, "Frame " + std::to_string(frameIndex));
+
+            const auto renderStart = std::chrono::steady_clock::now();
+            auto GetElapsedSeconds = [&renderStart]() {
+                return std::chrono::duration<float>(std::chrono::steady_clock::now() - renderStart).count();
+            };
+
+            std::uint32_t passCount = 0u, samplesPerPixel = 0u;
+            std::uint64_t frameSampleCount = 0u;
+            for (std::uint32_t band = 0u; band < bandCount; band++) {
+                const FrameRegion region = { 0u, band * bandHeight, width, std::min(bandHeight, height - band * bandHeight) };
+
+                std::fill(accumulation.begin(), accumulation.end(), Colorf32{ 0.f, 0.f, 0.f, 0.f });
+                std::fill(aovs.begin(), aovs.end(), Colorf32{ 0.f, 0.f, 0.f, 0.f });
+
+                // A Resumed Render Accumulates On Top Of Its Checkpoint
+                checkpointer.AddResumed(accumulation.data(), aovs.data());
+
+                // The Bands Split A Time Budget Evenly
+                const auto  bandStart  = std::chrono::steady_clock::now();
+                const float bandBudget = commandLineArguments.timeBudget / bandCount;
+
+                // Same Pass Structure As The GPU, So That A Time Budget Stops At The Same Granularity
+                passCount = samplesPerPixel = 0u;
+                for (bool bFinalPass = false; !bFinalPass; ) {
+                    if (checkpointer.IsDue())
+                        checkpointer.Write(accumulation.data(), aovs.data(), samplesPerPixel);
+
+                    const std::uint32_t sampleOffset = samplesPerPixel;
+                    const std::uint32_t sampleCount  = std::min(commandLineArguments.samplesPerPass, checkpointer.GetSampleCount() - sampleOffset);
+
+                    const float elapsedSeconds = std::chrono::duration<float>(std::chrono::steady_clock::now() - bandStart).count();
+                    const float passSeconds    = (passCount > 0u) ? (elapsedSeconds / passCount) : 0.f;
+
+                    bFinalPass = (sampleOffset + sampleCount >= checkpointer.GetSampleCount()) ||
+                        (commandLineArguments.timeBudget > 0.f && elapsedSeconds + passSeconds >= bandBudget);
+
+                    CpuTracer::PassParameters pass = CpuTracer::MakePassParameters(scene, cameras[frameIndex], width, height, commandLineArguments.maxBounces,
+                        checkpointer.GetFirstSample() + sampleOffset, sampleCount, frameIndex, commandLineArguments.sampleSequence, aovs.empty() ? nullptr : aovs.data());
+                    pass.firstRow = region.offsetY;
+                    pass.rowCount = region.height;
+
+                    rayCount += TraceCpuPass(pass, traceTile, commandLineArguments.tileSize, accumulation.data());
+
+                    passCount++;
+                    samplesPerPixel += sampleCount;
+                }
+
+                frameSampleCount += region.GetPixelCount() * samplesPerPixel;
+
+                if (commandLineArguments.bOutOfCore) {
+                    const auto streamStart = std::chrono::steady_clock::now();
+
+                    ResolveAccumulation(accumulation.data(), resolvedBand.data(), region.GetPixelCount(), commandLineArguments.toneMapping);
+                    frameStreamer.AddRegion(GetFrameOutputFilename(commandLineArguments, frameIndex), region, resolvedBand.data());
+
+                    profiler.AddToTotal("Stream Bands", streamStart);
+                }
+            }
+
+            profileCounters.samples += frameSampleCount;
+
+            if (commandLineArguments.bOutOfCore) {
+                std::printf("Frame %u: %.2f Samples Per Pixel On Average Over %u Bands (%.3fs)\n", frameIndex,
+                    static_cast<double>(frameSampleCount) / (static_cast<double>(width) * height), bandCount, GetElapsedSeconds());
+                continue;
+            }
+
+            std::printf("Frame %u: %u Samples Per Pixel In %u Passes (%.3fs)\n", frameIndex, samplesPerPixel, passCount, GetElapsedSeconds());
+
+            if (checkpointer.IsEnabled())
+                checkpointer.Write(accumulation.data(), aovs.data(), samplesPerPixel);
+
+            SaveFrame(commandLineArguments, accumulation.data(), aovs.data(), GetFrameOutputFilename(commandLineArguments, frameIndex), frameIndex, profiler);
+        }
+    }
+
+    profileCounters.renderSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - batchStart).count();
+    profileCounters.rays          = rayCount;
+
+    if (profiler.IsEnabled()) {
+        profiler.WriteReport(commandLineArguments.profileFilename, std::string("CPU (") + pPacketDescription + ")", profileCounters);
+
+        std::printf("Profile Written To %s (%.3f Mrays/s)\n", commandLineArguments.profileFilename.c_str(),
+            (profileCounters.renderSeconds > 0.0) ? (profileCounters.rays / profileCounters.renderSeconds / 1e6) : 0.0);
+    }
+}
+
+// ./PolarTracer bench sampling -w <n> -h <n> [--spp <n>] [--reference-spp <n>] [--scene <file>] ...
+// Measures How Fast Each Sampler Converges: The Error Of Every Power-Of-Two Sample Count Against A Converged Reference
+// Runs On The CPU Tracer, Which Traces The Same Paths As The GPU Kernels, So It Needs No Device & Is Deterministic
+void RunSamplingBenchmark(const CommandLineArguments& commandLineArguments, const Scene& scene, const Camera& camera) {
+    const std::uint32_t width      = commandLineArguments.surfaceWidth;
+    const std::uint32_t height     = commandLineArguments.surfaceHeight;
+    const size_t        pixelCount = static_cast<size_t>(width) * height;
+
+    const char*                        pPacketDescription = nullptr;
+    const CpuTracer::TraceTileFunction traceTile          = SelectCpuTraceTile(pPacketDescription);
+
+    // Accumulates 'samplesPerPixel' Samples In Passes Of --spp-per-pass & Returns The Resolved Radiance (Averaged Over The Channels)
+    auto Render = [&](const SampleSequence sampleSequence, const std::uint32_t samplesPerPixel, const std::uint32_t frameIndex) {
+        std::vector<Colorf32> accumulation(pixelCount, Colorf32{ 0.f, 0.f, 0.f, 0.f });
+
+        for (std::uint32_t sampleOffset = 0u; sampleOffset < samplesPerPixel; sampleOffset += commandLineArguments.samplesPerPass) {
+            const std::uint32_t sampleCount = std::min(commandLineArguments.samplesPerPass, samplesPerPixel - sampleOffset);
+
+            const CpuTracer::PassParameters pass = CpuTracer::MakePassParameters(scene, camera, width, height, commandLineArguments.maxBounces,
+                sampleOffset, sampleCount, frameIndex, sampleSequence);
+            TraceCpuPass(pass, traceTile, commandLineArguments.tileSize, accumulation.data());
+        }
+
+        std::vector<float> radiance(pixelCount);
+        for (size_t i = 0u; i < pixelCount; i++)
+            radiance[i] = (accumulation[i].r + accumulation[i].g + accumulation[i].b) / (3.f * accumulation[i].a);
+
+        return radiance;
+    };
+
+    std::printf("Sampling Benchmark: %ux%u, %u Bounces, CPU %s Ray Packets\n", width, height, commandLineArguments.maxBounces, pPacketDescription);
+
+    // Seeded With A Frame Index No Render Uses, So That Its Noise Is Independent Of The Images Measured Against It
+    const auto   referenceStart = std::chrono::steady_clock::now();
+    const auto   reference      = Render(SampleSequence::ePCG, commandLineArguments.referenceSamplesPerPixel, UINT32_MAX);
+    const double referenceSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - referenceStart).count();
+
+    std::printf("Reference: PCG, %u Samples Per Pixel (%.3fs)\n\n", commandLineArguments.referenceSamplesPerPixel, referenceSeconds);
+    std::printf("%8s  %14s  %10s  %14s  %10s\n", "SPP", "PCG RMSE", "PCG s", "Sobol RMSE", "Sobol s");
+
+    for (std::uint32_t samplesPerPixel = 1u; samplesPerPixel <= commandLineArguments.samplesPerPixel; samplesPerPixel *= 2u) {
+        double rmse[2], seconds[2];
+
+        for (const SampleSequence sampleSequence : { SampleSequence::ePCG, SampleSequence::eSobolOwen }) {
+            const size_t i     = static_cast<size_t>(sampleSequence);
+            const auto   start = std::chrono::steady_clock::now();
+            const auto   image = Render(sampleSequence, samplesPerPixel, 0u);
+            seconds[i] = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+            double squaredError = 0.0;
+            for (size_t p = 0u; p < pixelCount; p++)
+                squaredError += static_cast<double>(image[p] - reference[p]) * (image[p] - reference[p]);
+
+            rmse[i] = std::sqrt(squaredError / pixelCount);
+        }
+
+        std::printf("%8u  %14.6f  %10.3f  %14.6f  %10.3f\n", samplesPerPixel, rmse[0], seconds[0], rmse[1], seconds[1]);
+    }
+}
+
+std::optional<std::vector<char>> ReadBinaryFile(const std::filesystem::path& path) {
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file.is_open())
+        return std::nullopt;
+
+    std::vector<char> contents(static_cast<size_t>(file.tellg()));
+
+    file.seekg(0);
+    file.read(contents.data(), contents.size());
+
+    return contents;
+}
+
+// Writes To A Temporary File First So That Concurrent Runs Never Observe A Partial File
+void WriteBinaryFileAtomically(const std::filesystem::path& path, const void* pData, const size_t size) {
+    std::filesystem::create_directories(path.parent_path());
+
+    const std::filesystem::path temporaryPath = path.string() + ".tmp";
+    {
+        std::ofstream file(temporaryPath, std::ios::binary | std::ios::trunc);
+        if (!file.is_open())
+            throw std::runtime_error("Failed To Write " + path.string());
+
+        file.write(reinterpret_cast<const char*>(pData), size);
+    }
+
+    std::filesystem::rename(temporaryPath, path);
+}
+
+using ShaderDefines = std::vector<std::pair<std::string, std::string>>;
+
+// Inlines Every '#include "file"' Line (Relative To The Including File), So That The Cache Hash Covers
+// The Included Files & shaderc Needs No Includer
+std::string ExpandShaderIncludes(const std::filesystem::path& path, const std::uint32_t depth = 0u) {
+    if (depth > 16u)
+        throw std::runtime_error("Shader Includes Nested Too Deeply In " + path.string());
+
+    const auto source = ReadBinaryFile(path);
+    if (!source)
+        throw std::runtime_error("Failed To Open Shader File " + path.string());
+
+    std::istringstream stream(std::string(source->begin(), source->end()));
+    std::string        expanded, line;
+    while (std::getline(stream, line)) {
+        const size_t directiveStart = line.find_first_not_of(" \t");
+        if (directiveStart != std::string::npos && line.compare(directiveStart, 8u, "#include") == 0) {
+            const size_t nameStart = line.find('"', directiveStart);
+            const size_t nameEnd   = (nameStart == std::string::npos) ? std::string::npos : line.find('"', nameStart + 1u);
+            if (nameEnd == std::string::npos)
+                throw std::runtime_error("Malformed #include In " + path.string() + ": " + line);
+
+            expanded += ExpandShaderIncludes(path.parent_path() / line.substr(nameStart + 1u, nameEnd - nameStart - 1u), depth + 1u);
+        } else {
+            expanded += line;
+        }
+
+        expanded += '\n';
+    }
+
+    return expanded;
+}
+
+// Whether The SPIR-V Decorates Any Constant With A SpecId: Every Kernel Takes At Least Its Workgroup Size As A Specialization Constant,
+// So A Binary Without One Was Built From A Shader That Predates Them
+bool SpirvHasSpecializationConstants(const std::vector<std::uint32_t>& spirv) noexcept {
+    constexpr std::uint32_t SPIRV_HEADER_WORDS = 5u;
+    constexpr std::uint32_t OP_DECORATE        = 71u;
+    constexpr std::uint32_t DECORATION_SPEC_ID = 1u;
+
+    for (size_t i = SPIRV_HEADER_WORDS; i < spirv.size(); ) {
+        const std::uint32_t wordCount = spirv[i] >> 16u;
+        if (wordCount == 0u)
+            break;
+
+        // OpDecorate <Target> <Decoration> [Operands]
+        if ((spirv[i] & 0xFFFFu) == OP_DECORATE && wordCount >= 3u && i + 2u < spirv.size() && spirv[i + 2u] == DECORATION_SPEC_ID)
+            return true;
+
+        i += wordCount;
+    }
+
+    return false;
+}
+
+// Returns The SPIR-V For 'sourcePath' Compiled With 'defines'
+// The Result Is Cached On Disk Under A Hash Of The Source & Defines, So Warm Starts Skip Compilation
+std::vector<std::uint32_t> LoadShaderSpirv(const std::string& sourcePath, const ShaderDefines& defines, const std::string& cacheDirectory) {
+    constexpr std::uint32_t SPIRV_MAGIC_NUMBER = 0x07230203u;
+    constexpr char          SHADER_CACHE_TAG[] = "polar-spirv-v1;vulkan1.0;O"; // Bump When The Compile Options Change
+
+    const std::string source = ExpandShaderIncludes(sourcePath);
+
+    std::uint64_t hash = HashBytes(SHADER_CACHE_TAG, sizeof(SHADER_CACHE_TAG));
+    hash = HashBytes(source.data(), source.size(), hash);
+    for (const auto& [name, value] : defines) {
+        hash = HashBytes(name.data(),  name.size() + 1u,  hash); // Includes The Null Terminator As A Separator
+        hash = HashBytes(value.data(), value.size() + 1u, hash);
+    }
+
+    char hashString[17] = { 0 };
+    std::snprintf(hashString, sizeof(hashString), "%016llx", static_cast<unsigned long long>(hash));
+
+    const std::filesystem::path cachedPath = std::filesystem::path(cacheDirectory) / "shaders" / (std::string(hashString) + ".spv");
+
+    auto ToSpirv = [](const std::vector<char>& bytes) {
+        std::vector<std::uint32_t> spirv(bytes.size() / sizeof(std::uint32_t));
+        std::memcpy(spirv.data(), bytes.data(), spirv.size() * sizeof(std::uint32_t));
+        return spirv;
+    };
+
+    if (const auto cached = ReadBinaryFile(cachedPath)) {
+        const auto spirv = ToSpirv(*cached);
+
+        if (cached->size() % sizeof(std::uint32_t) == 0u && !spirv.empty() && spirv[0] == SPIRV_MAGIC_NUMBER)
+            return spirv;
+    }
+
+#ifdef POLAR_USE_SHADERC
+    shaderc::Compiler       compiler;
+    shaderc::CompileOptions options;
+
+    for (const auto& [name, value] : defines)
+        options.AddMacroDefinition(name, value);
+
+    options.SetTargetEnvironment(shaderc_target_env_vulkan, shaderc_env_version_vulkan_1_0);
+    options.SetOptimizationLevel(shaderc_optimization_level_performance);
+
+    const shaderc::SpvCompilationResult result = compiler.CompileGlslToSpv(source.data(), source.size(), shaderc_compute_shader, sourcePath.c_str(), options);
+    if (result.GetCompilationStatus() != shaderc_compilation_status_success)
+        throw std::runtime_error("Failed To Compile " + sourcePath + ":\n" + result.GetErrorMessage());
+
+    const std::vector<std::uint32_t> spirv(result.cbegin(), result.cend());
+
+    WriteBinaryFileAtomically(cachedPath, spirv.data(), spirv.size() * sizeof(std::uint32_t));
+
+    return spirv;
+#else
+    // Without shaderc Only The Prebuilt Binary Is Available (Built By glslc Next To Its Source: x.glsl -> x.spv)
+    if (!defines.empty())
+        throw std::runtime_error("Shader Defines Require Building With POLAR_USE_SHADERC");
+
+    const std::filesystem::path prebuiltPath = std::filesystem::path(sourcePath).replace_extension(".spv");
+    const auto prebuilt = ReadBinaryFile(prebuiltPath);
+    if (!prebuilt)
+        throw std::runtime_error("Failed To Open Shader File " + prebuiltPath.string());
+
+    // The Host Specializes Every Pipeline, A Stale Binary Would Silently Ignore The Job's Size & Options
+    const auto spirv = ToSpirv(*prebuilt);
+    if (prebuilt->size() % sizeof(std::uint32_t) != 0u || spirv.empty() || spirv[0] != SPIRV_MAGIC_NUMBER)
+        throw std::runtime_error(prebuiltPath.string() + " Is Not SPIR-V");
+    if (!SpirvHasSpecializationConstants(spirv))
+        throw std::runtime_error(prebuiltPath.string() + " Is Out Of Date (No Specialization Constants), Rebuild It From " + sourcePath);
+
+    return spirv;
+#endif
+}
+
+// Loads A Previously Serialized Pipeline Cache If It Was Written By The Same Device & Driver
+vk::PipelineCache LoadPipelineCache(const vk::Device& device, const vk::PhysicalDeviceProperties& properties, const std::filesystem::path& path) {
+    std::vector<char> initialData;
+
+    if (auto cached = ReadBinaryFile(path)) {
+        // VkPipelineCacheHeaderVersionOne: Length, Version, Vendor ID, Device ID, Cache UUID
+        constexpr size_t HEADER_SIZE = 4u * sizeof(std::uint32_t) + VK_UUID_SIZE;
+
+        if (cached->size() >= HEADER_SIZE) {
+            std::uint32_t header[4];
+            std::memcpy(header, cached->data(), sizeof(header));
+
+            const bool bCompatible = header[0] >= HEADER_SIZE && header[1] == 1u &&
+                header[2] == properties.vendorID && header[3] == properties.deviceID &&
+                std::memcmp(cached->data() + sizeof(header), properties.pipelineCacheUUID.data(), VK_UUID_SIZE) == 0;
+
+            if (bCompatible)
+                initialData = std::move(*cached);
+        }
+    }
+
+    const auto pipelineCacheCreateInfo = vk::PipelineCacheCreateInfo(vk::PipelineCacheCreateFlags{}, initialData.size(), initialData.data());
+    return device.createPipelineCache(pipelineCacheCreateInfo);
+}
+
+void SavePipelineCache(const vk::Device& device, const vk::PipelineCache& pipelineCache, const std::filesystem::path& path) {
+    const auto data = device.getPipelineCacheData(pipelineCache);
+
+    WriteBinaryFileAtomically(path, data.data(), data.size());
+}
+
+// Sub-Allocates Buffers From Large Per-Memory-Type Blocks Instead Of One vkAllocateMemory Per Buffer
+// Each Block Keeps A Free-List Of Ranges (Offset -> Size) That Is Coalesced On Free
+class VulkanMemoryArena {
+public:
+    struct Allocation {
+        vk::DeviceMemory memory;
+        vk::DeviceSize   offset = 0u;
+        vk::DeviceSize   size   = 0u;
+        std::uint32_t    memoryTypeIndex = 0u;
+        size_t           blockIndex      = 0u;
+        void*            pMapped = nullptr; // Persistently Mapped Pointer When The Memory Is Host Visible
+    }; // Allocation
+
+private:
+    struct Block {
+        vk::DeviceMemory memory;
+        vk::DeviceSize   size;
+        void*            pMapped;
+
+        std::map<vk::DeviceSize, vk::DeviceSize> freeRanges;
+    }; // Block
+
+    const vk::Device& m_device;
+
+    vk::PhysicalDeviceMemoryProperties m_memoryProperties;
+    vk::DeviceSize                     m_blockSize;
+    vk::DeviceSize                     m_nonCoherentAtomSize;
+    std::uint32_t                      m_maxAllocationCount;
+    std::uint32_t                      m_allocationCount = 0u;
+
+    std::array<std::vector<Block>, VK_MAX_MEMORY_TYPES> m_blocks;
+
+    // Per Heap: Bytes Handed Out To Buffers & Bytes Allocated From The Driver
+    std::array<vk::DeviceSize, VK_MAX_MEMORY_HEAPS> m_heapUsage         = {};
+    std::array<vk::DeviceSize, VK_MAX_MEMORY_HEAPS> m_heapPeakUsage     = {};
+    std::array<vk::DeviceSize, VK_MAX_MEMORY_HEAPS> m_heapCommitted     = {};
+    std::array<vk::DeviceSize, VK_MAX_MEMORY_HEAPS> m_heapPeakCommitted = {};
+
+    static inline vk::DeviceSize AlignUp(const vk::DeviceSize value, const vk::DeviceSize alignment) noexcept {
+        return (value + alignment - 1u) / alignment * alignment;
+    }
+
+    bool IsNonCoherent(const std::uint32_t memoryTypeIndex) const noexcept {
+        const vk::MemoryPropertyFlags flags = this->m_memoryProperties.memoryTypes[memoryTypeIndex].propertyFlags;
+        return (flags & vk::MemoryPropertyFlagBits::eHostVisible) && !(flags & vk::MemoryPropertyFlagBits::eHostCoherent);
+    }
+
+    // First-Fit Search Through A Block's Free Ranges
+    std::optional<vk::DeviceSize> TryAllocateFromBlock(Block& block, const vk::DeviceSize size, const vk::DeviceSize alignment) {
+        for (auto it = block.freeRanges.begin(); it != block.freeRanges.end(); it++) {
+            const vk::DeviceSize rangeOffset = it->first;
+            const vk::DeviceSize rangeEnd    = it->first + it->second;
+            const vk::DeviceSize offset      = AlignUp(rangeOffset, alignment);
+
+            if (offset + size > rangeEnd)
+                continue;
+
+            // Split The Range, Keeping The Alignment Padding & The Tail Free
+            block.freeRanges.erase(it);
+            if (offset > rangeOffset)
+                block.freeRanges[rangeOffset] = offset - rangeOffset;
+            if (offset + size < rangeEnd)
+                block.freeRanges[offset + size] = rangeEnd - (offset + size);
+
+            return offset;
+        }
+
+        return std::nullopt;
+    }
+
+    std::optional<size_t> TryCreateBlock(const std::uint32_t memoryTypeIndex, const vk::DeviceSize minimumSize) {
+        if (this->m_allocationCount >= this->m_maxAllocationCount)
+            return std::nullopt;
+
+        const std::uint32_t  heapIndex = this->m_memoryProperties.memoryTypes[memoryTypeIndex].heapIndex;
+        const vk::DeviceSize heapSize  = this->m_memoryProperties.memoryHeaps[heapIndex].size;
+
+        // Small Heaps (E.g. The 256MiB BAR Heap) Get Smaller Blocks
+        const vk::DeviceSize blockSize = std::max(minimumSize, std::min(this->m_blockSize, heapSize / 8u));
+
+        Block block;
+        block.size    = blockSize;
+        block.pMapped = nullptr;
+
+        try {
+            block.memory = this->m_device.allocateMemory(vk::MemoryAllocateInfo(blockSize, memoryTypeIndex));
+        } catch (const vk::SystemError&) {
+            return std::nullopt; // Out Of Memory In This Heap, The Caller Moves On To The Next Preference
+        }
+
+        if (this->m_memoryProperties.memoryTypes[memoryTypeIndex].propertyFlags & vk::MemoryPropertyFlagBits::eHostVisible)
+            block.pMapped = this->m_device.mapMemory(block.memory, 0u, VK_WHOLE_SIZE);
+
+        block.freeRanges[0u] = blockSize;
+
+        this->m_allocationCount++;
+        this->m_heapCommitted[heapIndex] += blockSize;
+        this->m_heapPeakCommitted[heapIndex] = std::max(this->m_heapPeakCommitted[heapIndex], this->m_heapCommitted[heapIndex]);
+
+        this->m_blocks[memoryTypeIndex].push_back(block);
+        return this->m_blocks[memoryTypeIndex].size() - 1u;
+    }
+
+public:
+    VulkanMemoryArena(const vk::Device& device, const vk::PhysicalDevice& physicalDevice, const vk::DeviceSize blockSize = 64ull << 20) noexcept
+        : m_device(device), m_blockSize(blockSize)
+    {
+        const auto physicalDeviceProperties = physicalDevice.getProperties();
+
+        this->m_memoryProperties    = physicalDevice.getMemoryProperties();
+        this->m_nonCoherentAtomSize = physicalDeviceProperties.limits.nonCoherentAtomSize;
+        this->m_maxAllocationCount  = physicalDeviceProperties.limits.maxMemoryAllocationCount;
+    }
+
+    // Tries Each Set Of Memory Properties In Order Of Preference
+    Allocation Allocate(const vk::MemoryRequirements& requirements, const std::initializer_list<vk::MemoryPropertyFlags>& memoryPreferences) {
+        for (const vk::MemoryPropertyFlags& memoryRequirements : memoryPreferences) {
+            for (std::uint32_t i = 0u; i < this->m_memoryProperties.memoryTypeCount; i++) {
+                const bool condition0 = requirements.memoryTypeBits & (1 << i);
+                const bool condition1 = (this->m_memoryProperties.memoryTypes[i].propertyFlags & memoryRequirements) == memoryRequirements;
+
+                if (!condition0 || !condition1)
+                    continue;
+
+                // Non-Coherent Ranges Are Aligned To The Atom Size So That They Can Be Invalidated Independently
+                const vk::DeviceSize alignment = this->IsNonCoherent(i) ? std::max(requirements.alignment, this->m_nonCoherentAtomSize) : requirements.alignment;
+                const vk::DeviceSize size      = this->IsNonCoherent(i) ? AlignUp(requirements.size, this->m_nonCoherentAtomSize) : requirements.size;
+
+                Allocation allocation;
+                allocation.memoryTypeIndex = i;
+                allocation.size            = size;
+
+                std::optional<vk::DeviceSize> offset;
+                for (size_t b = 0u; b < this->m_blocks[i].size() && !offset; b++) {
+                    offset = this->TryAllocateFromBlock(this->m_blocks[i][b], size, alignment);
+                    allocation.blockIndex = b;
+                }
+
+                if (!offset) {
+                    const auto newBlockIndex = this->TryCreateBlock(i, size);
+                    if (!newBlockIndex)
+                        continue;
+
+                    offset = this->TryAllocateFromBlock(this->m_blocks[i][*newBlockIndex], size, alignment);
+                    allocation.blockIndex = *newBlockIndex;
+                }
+
+                const Block& block = this->m_blocks[i][allocation.blockIndex];
+                allocation.memory  = block.memory;
+                allocation.offset  = *offset;
+                allocation.pMapped = block.pMapped ? (static_cast<std::uint8_t*>(block.pMapped) + *offset) : nullptr;
+
+                const std::uint32_t heapIndex = this->m_memoryProperties.memoryTypes[i].heapIndex;
+                this->m_heapUsage[heapIndex] += size;
+                this->m_heapPeakUsage[heapIndex] = std::max(this->m_heapPeakUsage[heapIndex], this->m_heapUsage[heapIndex]);
+
+                return allocation;
+            }
+        }
+
+        throw std::runtime_error("Could not find a suitable memory type to allocate a buffer");
+    }
+
+    void Free(const Allocation& allocation) noexcept {
+        Block& block = this->m_blocks[allocation.memoryTypeIndex][allocation.blockIndex];
+
+        auto it = block.freeRanges.emplace(allocation.offset, allocation.size).first;
+
+        // Coalesce With The Following Range
+        const auto next = std::next(it);
+        if (next != block.freeRanges.end() && it->first + it->second == next->first) {
+            it->second += next->second;
+            block.freeRanges.erase(next);
+        }
+
+        // Coalesce With The Preceding Range
+        if (it != block.freeRanges.begin()) {
+            const auto previous = std::prev(it);
+            if (previous->first + previous->second == it->first) {
+                previous->second += it->second;
+                block.freeRanges.erase(it);
+            }
+        }
+
+        this->m_heapUsage[this->m_memoryProperties.memoryTypes[allocation.memoryTypeIndex].heapIndex] -= allocation.size;
+    }
+
+    void Invalidate(const Allocation& allocation) const noexcept {
+        if (this->IsNonCoherent(allocation.memoryTypeIndex))
+            this->m_device.invalidateMappedMemoryRanges(vk::MappedMemoryRange(allocation.memory, allocation.offset, allocation.size));
+    }
+
+    void Flush(const Allocation& allocation) const noexcept {
+        if (this->IsNonCoherent(allocation.memoryTypeIndex))
+            this->m_device.flushMappedMemoryRanges(vk::MappedMemoryRange(allocation.memory, allocation.offset, allocation.size));
+    }
+
+    // Frees Every Block, All Sub-Allocations Must Have Been Released
+    void Destroy() noexcept {
+        for (auto& blocks : this->m_blocks) {
+            for (const Block& block : blocks) {
+                if (block.pMapped)
+                    this->m_device.unmapMemory(block.memory);
+
+                this->m_device.freeMemory(block.memory);
+            }
+
+            blocks.clear();
+        }
+
+        this->m_allocationCount = 0u;
+        this->m_heapCommitted.fill(0u);
+    }
+
+    // Peak Bytes Allocated From Device-Local Heaps
+    vk::DeviceSize GetPeakDeviceLocalCommitted() const noexcept {
+        vk::DeviceSize total = 0u;
+        for (std::uint32_t i = 0u; i < this->m_memoryProperties.memoryHeapCount; i++)
+            if (this->m_memoryProperties.memoryHeaps[i].flags & vk::MemoryHeapFlagBits::eDeviceLocal)
+                total += this->m_heapPeakCommitted[i];
+
+        return total;
+    }
+
+    void PrintUsageReport() const noexcept {
+        for (std::uint32_t i = 0u; i < this->m_memoryProperties.memoryHeapCount; i++) {
+            if (this->m_heapPeakCommitted[i] == 0u)
+                continue;
+
+            const bool bDeviceLocal = static_cast<bool>(this->m_memoryProperties.memoryHeaps[i].flags & vk::MemoryHeapFlagBits::eDeviceLocal);
+
+            std::printf("Memory Heap %u (%s): Peak %.2f MiB Used, %.2f MiB Allocated\n", i, bDeviceLocal ? "Device Local" : "Host",
+                this->m_heapPeakUsage[i] / (1024.0 * 1024.0), this->m_heapPeakCommitted[i] / (1024.0 * 1024.0));
+        }
+    }
+}; // VulkanMemoryArena
+
+class VulkanBuffer {
+private:
+    size_t m_size = 0u;
+
+    const vk::Device* m_pDevice = nullptr; // A Pointer, So That Buffers Can Be Assigned Into Place
+
+    vk::Buffer                    m_buffer;
+    VulkanMemoryArena*            m_pArena = nullptr;
+    VulkanMemoryArena::Allocation m_allocation;
+
+public:
+    VulkanBuffer() = default;
+
+    // Buffers Shared By Several Queue Families Use Concurrent Sharing To Avoid Ownership Transfers
+    VulkanBuffer(const vk::Device& device, const size_t size, const vk::BufferUsageFlags& usage, const std::vector<std::uint32_t>& queues) noexcept
+        : m_size(size), m_pDevice(&device)
+    {
+        const std::set<std::uint32_t> uniqueQueues(queues.begin(), queues.end());
+        const std::vector<std::uint32_t> queueFamilies(uniqueQueues.begin(), uniqueQueues.end());
+
+        // Create The Buffer
+        const auto bufferCreateInfo = vk::BufferCreateInfo(
+            vk::BufferCreateFlags{}, this->m_size,
+            usage, (queueFamilies.size() > 1u) ? vk::SharingMode::eConcurrent : vk::SharingMode::eExclusive,
+            static_cast<std::uint32_t>(queueFamilies.size()), queueFamilies.data()
+        );
+
+        this->m_buffer = device.createBuffer(bufferCreateInfo);
+    }
+
+    // Sub-Allocates From The Arena, Trying Each Set Of Memory Properties In Order Of Preference
+    void Allocate(VulkanMemoryArena& arena, const std::initializer_list<vk::MemoryPropertyFlags>& memoryPreferences) {
+        const auto bufferMemoryRequirements = this->m_pDevice->getBufferMemoryRequirements(this->m_buffer);
+
+        this->m_pArena     = &arena;
+        this->m_allocation = arena.Allocate(bufferMemoryRequirements, memoryPreferences);
+    }
+
+    void Bind() const noexcept {
+        this->m_pDevice->bindBufferMemory(this->m_buffer, this->m_allocation.memory, this->m_allocation.offset);
+    }
+
+    // Host-Visible Blocks Stay Mapped For Their Whole Lifetime
+    void* MapMemory() const noexcept {
+        return this->m_allocation.pMapped;
+    }
+
+    // Makes Device Writes Visible To The Mapped Pointer (No-Op For Coherent Memory)
+    void InvalidateMappedMemory() const noexcept {
+        this->m_pArena->Invalidate(this->m_allocation);
+    }
+
+    // Makes Host Writes Through The Mapped Pointer Visible To The Device (No-Op For Coherent Memory)
+    void FlushMappedMemory() const noexcept {
+        this->m_pArena->Flush(this->m_allocation);
+    }
+
+    void UnAllocate() const noexcept {
+        this->m_pArena->Free(this->m_allocation);
+    }
+
+    void Destroy() const noexcept {
+        this->m_pDevice->destroyBuffer(this->m_buffer);
+    }
+
+    vk::DescriptorBufferInfo GetDescriptorBufferInfo() const noexcept {
+        return vk::DescriptorBufferInfo(this->m_buffer, 0, this->m_size);
+    }
+
+    const vk::Buffer&       GetBuffer()       const noexcept { return this->m_buffer; }
+    const vk::DeviceMemory& GetDeviceMemory() const noexcept { return this->m_allocation.memory; }
+};
+
+// A Frame's Buffers On One Device
+// In Batch Mode, Frame N+1 Is Traced While Frame N Is Read Back And Frame N-1 Is Encoded, So Each Of Those Frames Owns A Set Of Buffers
+struct FrameResources {
+    VulkanBuffer      accumulationBuffer;
+    VulkanBuffer      stagingBuffer;
+    VulkanBuffer      momentsBuffer;          // Adaptive Sampling's Per-Pixel Moments,
+    VulkanBuffer      pixelListHeaderBuffer;  // Per-Tile List Headers
+    VulkanBuffer      pixelListBuffer;        // & Lists Of Unconverged Pixels (Placeholders Otherwise)
+    VulkanBuffer      aovBuffer;              // Two Entries Per Pixel Accumulated Next To The Color With AOVs (A Placeholder Otherwise)
+    VulkanBuffer      resolvedBuffer;         // One Word Per Pixel Packed By resolve.glsl, Read Back Instead Of The Accumulation (A Placeholder With GpuResolve::eHost)
+    vk::DescriptorSet descriptorSet;
+    vk::Fence         readbackFence;     // Signaled Once The Frame's Tiles Are In The Staging Buffer
+    vk::Semaphore     readbackSemaphore; // Orders The Copies Of Tiles Left Out Of The Final Pass Before The Readback Fence
+    bool              bCleared = false;  // Whether The Device Cleared The Accumulation For The Current Frame
+    std::vector<bool> tilesTraced;       // The Tiles The Device Traced Samples Of During The Frame,
+    std::vector<bool> tilesReadBack;     // & The Ones It Already Copied To The Staging Buffer
+}; // FrameResources
+
+// Everything One Logical Device Renders With. Every Selected Device Gets One & The Scheduler In RenderGpuJob() Hands Them Tiles
+// Heap Allocated Since The Memory Arena & The Buffers Keep References To 'logicalDevice'
+struct GpuDevice {
+    std::uint32_t                          physicalDeviceIndex = 0u; // As Listed By The Instance (& --devices)
+    vk::PhysicalDevice                     physicalDevice;
+    vk::PhysicalDeviceProperties           properties;
+    std::vector<vk::QueueFamilyProperties> queueFamilyProperties;
+    std::string                            name;
+
+    std::uint32_t computeQueueIndex       = 0u;
+    std::uint32_t transferQueueIndex      = 0u;
+    bool          bDedicatedTransferQueue = false;
+    std::uint32_t workgroupSize           = GPU_WORKGROUP_SIZE;
+
+    vk::Device                       logicalDevice;
+    vk::Queue                        computeQueue, transferQueue;
+    std::optional<VulkanMemoryArena> memoryArena;
+
+    std::vector<FrameResources> frameResources;
+    std::optional<VulkanBuffer> rayStatsBuffer; // Only Written To When Profiling
+    std::optional<VulkanBuffer> sceneBuffer;
+    std::vector<VulkanBuffer>   wavefrontBuffers; // Only With --kernel wavefront
+
+    // What The Frame Resources & Wavefront Queues Were Created For, Later Jobs That Fit Reuse Them
+    size_t        framePixelCapacity = 0u;
+    std::uint32_t frameTileCapacity  = 0u;
+    std::uint64_t wavefrontCapacity  = 0u;
+    std::uint32_t frameAccumulationStride = 0u; // Bytes Per Pixel Of The Accumulation, Staging & Resolved Buffers,
+    std::uint32_t frameStagingStride      = 0u; // Which Depend On The Job's Accumulation Format & Resolve
+    std::uint32_t frameResolvedStride     = 0u;
+
+    vk::DescriptorSetLayout descriptorSetLayout, wavefrontDescriptorSetLayout;
+    vk::DescriptorPool      descriptorPool;
+    vk::DescriptorSet       wavefrontDescriptorSet;
+
+    std::vector<vk::ShaderModule>                   shaderModules;
+    vk::ShaderModule                                resolveShaderModule;     // Created By The First Job That Resolves On The GPU
+    vk::PipelineCache                               pipelineCache;
+    std::filesystem::path                           pipelineCachePath;
+    vk::PipelineLayout                              computePipelineLayout;
+    vk::Pipeline                                    computePipeline;         // shader.glsl, Unless --kernel wavefront
+    std::array<vk::Pipeline, WAVEFRONT_STAGE_COUNT> wavefrontPipelines = {}; // Only With --kernel wavefront
+    vk::Pipeline                                    resolvePipeline;         // resolve.glsl
+    vk::Pipeline                                    adaptivePipeline;        // adaptive.glsl, Only With --adaptive
+
+    // The Pipelines Above Are The Current Job's, Picked From Those Built For Each Width, Height, Bounce Count, Accumulation Format,
+    // Resolve & Tone Mapping (One Per Shader Module)
+    std::map<std::array<std::uint32_t, 6u>, std::vector<vk::Pipeline>> specializedPipelines;
+
+    vk::CommandPool                commandPool, transferCommandPool;
+    std::vector<vk::CommandBuffer> commandBuffers, transferCommandBuffers;
+    std::vector<vk::Fence>         fences, transferFences;
+    std::vector<vk::Semaphore>     tileCompleteSemaphores;
+
+    // Two Timestamps Bracket Each Submit's Dispatch, Only When Profiling On A Queue That Supports Them
+    bool              bGpuTimestamps     = false;
+    std::uint32_t     timestampValidBits = 0u;
+    vk::QueryPool     timestampQueryPool;
+    std::vector<bool> slotHasTimestamps;
+
+    std::uint32_t submitIndex = 0u; // The Submit Slots Are Used Round-Robin
+    std::uint64_t tileCount   = 0u; // Tiles (Of Any Pass) Traced Over The Job
+}; // GpuDevice
+
+// At Most This Many Frames (Or Out-Of-Core Regions) Are In Flight: One Traced, One Read Back & One Encoded
+constexpr std::uint32_t MAX_FRAME_SLOTS = 3u;
+
+// The Instance & Its Devices, Created Once & Kept Over Every Job Of ./PolarTracer serve
+struct GpuContext {
+    vk::Instance                            instance;
+    std::vector<std::unique_ptr<GpuDevice>> devices;
+}; // GpuContext
+
+// Where A Job's Time Went, Reported By ./PolarTracer serve
+struct JobTimings {
+    double sceneSeconds     = 0.0;   // Loading The Scene, 0 When The Previous Job's Was Reused
+    double prepareSeconds   = 0.0;   // Sizing The Buffers, Uploading The Scene & Specializing The Pipelines
+    double renderSeconds    = 0.0;   // Tracing, Reading Back & Saving
+    bool   bReusedBuffers     = false; // Whether Every Device Already Had Buffers Large Enough,
+    bool   bReusedPipelines   = false; // Pipelines For The Job's Size & Bounce Count,
+    bool   bReusedDescriptors = false; // & Descriptor Sets Still Pointing At Its Buffers & Scene
+
+    // The Readback, Over Every Frame (./PolarTracer bench readback)
+    std::uint64_t readbackBytes       = 0u;  // Copied From The Devices' Buffers To The Staging Buffers
+    double        readbackWaitSeconds = 0.0; // The Host Waiting For Those Copies,
+    double        encodeSeconds       = 0.0; // & Turning Them Into Saved Images (Summed Over The Encode Threads)
+}; // JobTimings
+
+// Creates The Instance & A Logical Device For Each Selected Physical Device, With Everything That Doesn't Depend On A Job:
+// Queues, Memory Arena, Descriptor Layouts, Pipeline Layout & Cache, Shader Modules, Command Buffers & Synch Objects
+// The Options That Pick The Shaders Or Size These (--kernel, --adaptive, --aov, --denoise, --in-flight, --profile) Hold For Every Job
+GpuContext CreateGpuContext(const CommandLineArguments& commandLineArguments, Profiler& profiler) {
+#ifndef _DEBUG
+    constexpr std::uint32_t validationLayerCount = 0u;
+#else
+    constexpr std::uint32_t validationLayerCount = 1u;
+#endif
+
+    constexpr std::array<const char*, 1u> validationLayers = { "VK_LAYER_KHRONOS_validation" };
+
+    GpuContext                               context;
+    vk::Instance&                            instance = context.instance;
+    std::vector<std::unique_ptr<GpuDevice>>& devices  = context.devices;
+
+    { // Create Instance
+        const ProfileScope profileScope(profiler, "Create Instance");
+
+        constexpr auto appInfo = vk::ApplicationInfo(
+            "Polar-PTX",
+            VK_MAKE_VERSION(1, 0, 0),
+            "Polar-PTX",
+            VK_MAKE_VERSION(1, 0, 0),
+            VK_MAKE_VERSION(1, 0, 0)
+        );
+
+        const auto instanceCreateInfo = vk::InstanceCreateInfo(
+            vk::InstanceCreateFlags(),
+            &appInfo,
+            validationLayerCount,
+            validationLayers.data(),
+            0u,
+            nullptr
+        );
+
+        try {
+            instance = vk::createInstance(instanceCreateInfo);
+        } catch (const vk::SystemError& err) {
+            // No Vulkan Driver (e.g. A CI Machine Without A GPU)
+            throw NoCompatibleDeviceError(std::string("Failed To Create A Vulkan Instance: ") + err.what());
+        }
+    }
+
+    { // Pick Physical Devices
+        const ProfileScope profileScope(profiler, "Pick Physical Devices");
+
+        const auto physicalDevices = instance.enumeratePhysicalDevices();
+
+        if (!physicalDevices.size()) {
+            instance.destroy();
+            throw NoCompatibleDeviceError("No Physical Devices Found");
+        }
+
+        // A Device Is Compatible When One Of Its Queue Families Supports Compute
+        std::vector<std::optional<std::uint32_t>> computeQueueIndices(physicalDevices.size());
+        for (std::uint32_t i = 0u; i < physicalDevices.size(); i++) {
+            const auto properties            = physicalDevices[i].getProperties();
+            const auto queueFamilyProperties = physicalDevices[i].getQueueFamilyProperties();
+
+            for (std::uint32_t family = 0u; family < queueFamilyProperties.size(); family++) {
+                if (queueFamilyProperties[family].queueFlags & vk::QueueFlagBits::eCompute) {
+                    computeQueueIndices[i] = family;
+                    break;
+                }
+            }
+
+            std::printf("Device %u: %s (%s)%s\n", i, &properties.deviceName[0], vk::to_string(properties.deviceType).c_str(),
+                computeQueueIndices[i] ? "" : ", No Compute Queue");
+        }
+
+        // By Default Every Hardware Device Is Used, Software Implementations (e.g. lavapipe) Only When Listed Or With 'all'
+        // As They Are Slower Than The CPU Backend. A Device May Be Listed Twice, Each Entry Gets Its Own Logical Device
+        std::vector<std::uint32_t> selectedDevices;
+        if (commandLineArguments.deviceIndices.empty()) {
+            for (std::uint32_t i = 0u; i < physicalDevices.size(); i++)
+                if (computeQueueIndices[i] && (commandLineArguments.bAllDevices || physicalDevices[i].getProperties().deviceType != vk::PhysicalDeviceType::eCpu))
+                    selectedDevices.push_back(i);
+        } else {
+            for (const std::uint32_t i : commandLineArguments.deviceIndices) {
+                if (i >= physicalDevices.size() || !computeQueueIndices[i]) {
+                    instance.destroy();
+                    throw NoCompatibleDeviceError("Device " + std::to_string(i) + " Is Missing Or Has No Compute Queue");
+                }
+
+                selectedDevices.push_back(i);
+            }
+        }
+
+        if (selectedDevices.empty()) {
+            instance.destroy();
+            throw NoCompatibleDeviceError("No Compatible Physical Device Found");
+        }
+
+        for (const std::uint32_t i : selectedDevices) {
+            GpuDevice& device = *devices.emplace_back(std::make_unique<GpuDevice>());
+
+            device.physicalDeviceIndex   = i;
+            device.physicalDevice        = physicalDevices[i];
+            device.properties            = physicalDevices[i].getProperties();
+            device.queueFamilyProperties = physicalDevices[i].getQueueFamilyProperties();
+            device.name                  = &device.properties.deviceName[0];
+            device.computeQueueIndex     = *computeQueueIndices[i];
+        }
+    }
+
+    const bool bAdaptive  = commandLineArguments.adaptiveThreshold > 0.f;
+    const bool bWavefront = commandLineArguments.gpuKernel == GpuKernel::eWavefront;
+
+    // The SPIR-V Is The Same For Every Device, Only The Pipelines Are Built Per Device
+    std::vector<std::vector<std::uint32_t>> shaderSpirvs;
+    { // Load The Shaders
+        std::vector<const char*> shaderFiles = bWavefront ?
+            std::vector<const char*>(WAVEFRONT_SHADER_FILES.begin(), WAVEFRONT_SHADER_FILES.end()) : std::vector<const char*>{ "shader.glsl" };
+        if (bAdaptive)
+            shaderFiles.push_back("adaptive.glsl");
+
+        for (const char* shaderFile : shaderFiles) {
+            const ProfileScope profileScope(profiler, std::string("Load Shader ") + shaderFile);
+
+            shaderSpirvs.push_back(LoadShaderSpirv(shaderFile, ShaderDefines{}, commandLineArguments.cacheDirectory));
+        }
+    }
+
+    // Each Submit Renders One Tile For One Pass Using Its Own Command Buffer & Fence
+    // During The Final Pass, Each Tile Is Copied To The Staging Buffer As Soon As It Completes,
+    // Overlapping The Readback With The Remaining Tiles' Compute
+    const std::uint32_t submitSlotCount = commandLineArguments.maxSubmitsInFlight;
+
+    for (const std::unique_ptr<GpuDevice>& pDevice : devices) {
+        GpuDevice& device = *pDevice;
+
+        { // Look For A Dedicated Transfer Queue Family (Usually Backed By The GPU's Copy Engines)
+            device.transferQueueIndex = device.computeQueueIndex;
+
+            for (std::uint32_t i = 0u; i < device.queueFamilyProperties.size(); i++) {
+                const vk::QueueFlags queueFlags = device.queueFamilyProperties[i].queueFlags;
+
+                if ((queueFlags & vk::QueueFlagBits::eTransfer) && !(queueFlags & vk::QueueFlagBits::eCompute) && !(queueFlags & vk::QueueFlagBits::eGraphics)) {
+                    device.transferQueueIndex = i;
+                    break;
+                }
+            }
+
+            device.bDedicatedTransferQueue = device.transferQueueIndex != device.computeQueueIndex;
+        }
+
+        { // Fit The Workgroup Size To The Device's Limits
+            const auto& limits = device.properties.limits;
+
+            while (device.workgroupSize > 1u && (device.workgroupSize * device.workgroupSize > limits.maxComputeWorkGroupInvocations ||
+                device.workgroupSize > limits.maxComputeWorkGroupSize[0] || device.workgroupSize > limits.maxComputeWorkGroupSize[1]))
+                device.workgroupSize /= 2u;
+        }
+
+        { // Create Logical Device
+            const ProfileScope profileScope(profiler, "Create Logical Device");
+
+            const float queuePriority = 1.f;
+
+            const std::uint32_t queueCount = device.bDedicatedTransferQueue ? 2u : 1u;
+            vk::DeviceQueueCreateInfo queueCreateInfos[2u] = {
+                vk::DeviceQueueCreateInfo(vk::DeviceQueueCreateFlags(), device.computeQueueIndex,  1, &queuePriority),
+                vk::DeviceQueueCreateInfo(vk::DeviceQueueCreateFlags(), device.transferQueueIndex, 1, &queuePriority)
+            };
+
+            auto enabledFeatures = vk::PhysicalDeviceFeatures();
+
+            auto createInfo = vk::DeviceCreateInfo(
+                vk::DeviceCreateFlags(),
+                queueCount,
+                queueCreateInfos,
+                validationLayerCount,
+                validationLayers.data(),
+                0, nullptr, &enabledFeatures
+            );
+
+            device.logicalDevice = device.physicalDevice.createDevice(createInfo);
+        }
+
+        { // Fetch Queues
+            device.computeQueue  = device.logicalDevice.getQueue(device.computeQueueIndex,  0);
+            device.transferQueue = device.logicalDevice.getQueue(device.transferQueueIndex, 0);
+        }
+
+        device.memoryArena.emplace(device.logicalDevice, device.physicalDevice);
+        VulkanMemoryArena& memoryArena = *device.memoryArena;
+
+        const vk::Device&                logicalDevice = device.logicalDevice;
+        const std::vector<std::uint32_t> pQueues       = { device.computeQueueIndex, device.transferQueueIndex };
+
+        { // Create Descriptor Set Layouts & Pool
+            // Create Descriptor Set Layout
+            const std::array<vk::DescriptorSetLayoutBinding, 13u> descriptorSetLayoutBindings = {
+                // PixelBuffer
+                vk::DescriptorSetLayoutBinding(
+                    0u, vk::DescriptorType::eStorageBuffer,
+                    1u, vk::ShaderStageFlagBits::eCompute,
+                    nullptr
+                ),
+                // RayStats
+                vk::DescriptorSetLayoutBinding(
+                    1u, vk::DescriptorType::eStorageBuffer,
+                    1u, vk::ShaderStageFlagBits::eCompute,
+                    nullptr
+                ),
+                // Scene Materials, Spheres, Planes, Triangles & BVH Nodes
+                vk::DescriptorSetLayoutBinding(2u, vk::DescriptorType::eStorageBuffer, 1u, vk::ShaderStageFlagBits::eCompute, nullptr),
+                vk::DescriptorSetLayoutBinding(3u, vk::DescriptorType::eStorageBuffer, 1u, vk::ShaderStageFlagBits::eCompute, nullptr),
+                vk::DescriptorSetLayoutBinding(4u, vk::DescriptorType::eStorageBuffer, 1u, vk::ShaderStageFlagBits::eCompute, nullptr),
+                vk::DescriptorSetLayoutBinding(5u, vk::DescriptorType::eStorageBuffer, 1u, vk::ShaderStageFlagBits::eCompute, nullptr),
+                vk::DescriptorSetLayoutBinding(6u, vk::DescriptorType::eStorageBuffer, 1u, vk::ShaderStageFlagBits::eCompute, nullptr),
+                vk::DescriptorSetLayoutBinding(7u, vk::DescriptorType::eStorageBuffer, 1u, vk::ShaderStageFlagBits::eCompute, nullptr),
+                // Adaptive Sampling's Moments, Pixel List Headers & Pixel Lists
+                vk::DescriptorSetLayoutBinding(8u,  vk::DescriptorType::eStorageBuffer, 1u, vk::ShaderStageFlagBits::eCompute, nullptr),
+                vk::DescriptorSetLayoutBinding(9u,  vk::DescriptorType::eStorageBuffer, 1u, vk::ShaderStageFlagBits::eCompute, nullptr),
+                vk::DescriptorSetLayoutBinding(10u, vk::DescriptorType::eStorageBuffer, 1u, vk::ShaderStageFlagBits::eCompute, nullptr),
+                // AOVs
+                vk::DescriptorSetLayoutBinding(11u, vk::DescriptorType::eStorageBuffer, 1u, vk::ShaderStageFlagBits::eCompute, nullptr),
+                // Resolved Pixels
+                vk::DescriptorSetLayoutBinding(12u, vk::DescriptorType::eStorageBuffer, 1u, vk::ShaderStageFlagBits::eCompute, nullptr)
+            };
+
+            const auto descriptorSetLayoutCreateInfo = vk::DescriptorSetLayoutCreateInfo(
+                vk::DescriptorSetLayoutCreateFlags{},
+                static_cast<std::uint32_t>(descriptorSetLayoutBindings.size()),
+                descriptorSetLayoutBindings.data()
+            );
+
+            device.descriptorSetLayout = logicalDevice.createDescriptorSetLayout(descriptorSetLayoutCreateInfo);
+
+            // The Wavefront Buffers Are Set 1, Bound Next To The Frame's Set
+            std::array<vk::DescriptorSetLayoutBinding, 5u> wavefrontDescriptorSetLayoutBindings;
+            for (std::uint32_t binding = 0u; binding < wavefrontDescriptorSetLayoutBindings.size(); binding++)
+                wavefrontDescriptorSetLayoutBindings[binding] = vk::DescriptorSetLayoutBinding(binding, vk::DescriptorType::eStorageBuffer, 1u, vk::ShaderStageFlagBits::eCompute, nullptr);
+
+            if (bWavefront) {
+                const auto wavefrontDescriptorSetLayoutCreateInfo = vk::DescriptorSetLayoutCreateInfo(
+                    vk::DescriptorSetLayoutCreateFlags{},
+                    static_cast<std::uint32_t>(wavefrontDescriptorSetLayoutBindings.size()),
+                    wavefrontDescriptorSetLayoutBindings.data()
+                );
+
+                device.wavefrontDescriptorSetLayout = logicalDevice.createDescriptorSetLayout(wavefrontDescriptorSetLayoutCreateInfo);
+            }
+
+            // One Set Per Frame Slot, Plus The Wavefront Set. Every Job Allocates & Writes Them Again, Its Buffers May Be New
+            const std::uint32_t wavefrontSetCount  = bWavefront ? 1u : 0u;
+            const auto          descriptorPoolSize = vk::DescriptorPoolSize(vk::DescriptorType::eStorageBuffer,
+                MAX_FRAME_SLOTS * static_cast<std::uint32_t>(descriptorSetLayoutBindings.size()) + wavefrontSetCount * static_cast<std::uint32_t>(wavefrontDescriptorSetLayoutBindings.size()));
+            const auto descriptorPoolCreateInfo = vk::DescriptorPoolCreateInfo(vk::DescriptorPoolCreateFlags{}, MAX_FRAME_SLOTS + wavefrontSetCount, 1u, &descriptorPoolSize);
+            device.descriptorPool = logicalDevice.createDescriptorPool(descriptorPoolCreateInfo);
+        }
+
+        { // Create The Shader Modules, Pipeline Layout & Pipeline Cache
+            for (const std::vector<std::uint32_t>& spirv : shaderSpirvs) {
+                const auto shaderModuleCreateInfo = vk::ShaderModuleCreateInfo(vk::ShaderModuleCreateFlags{}, spirv.size() * sizeof(std::uint32_t), spirv.data());
+                device.shaderModules.push_back(logicalDevice.createShaderModule(shaderModuleCreateInfo));
+            }
+
+            const auto pushConstantRange = vk::PushConstantRange(vk::ShaderStageFlagBits::eCompute, 0u, sizeof(PassConstants));
+
+            const std::array<vk::DescriptorSetLayout, 2u> setLayouts = { device.descriptorSetLayout, device.wavefrontDescriptorSetLayout };
+            const auto pipelineLayoutCreateInfo = vk::PipelineLayoutCreateInfo(
+                vk::PipelineLayoutCreateFlags{},
+                bWavefront ? 2u : 1u, setLayouts.data(),
+                1u, &pushConstantRange
+            );
+
+            device.computePipelineLayout = logicalDevice.createPipelineLayout(pipelineLayoutCreateInfo);
+
+            // Each Kind Of Device Keeps Its Own Cache, So That Mixed Devices Don't Overwrite Each Other's
+            char pipelineCacheName[64] = { 0 };
+            std::snprintf(pipelineCacheName, sizeof(pipelineCacheName), "pipeline-cache-%08x-%08x.bin", device.properties.vendorID, device.properties.deviceID);
+            device.pipelineCachePath = std::filesystem::path(commandLineArguments.cacheDirectory) / pipelineCacheName;
+
+            device.pipelineCache = LoadPipelineCache(logicalDevice, device.properties, device.pipelineCachePath);
+        }
+
+        { // Create The Ray Counters
+            // Shared By All Frames & Jobs, Only Written To When Profiling
+            device.rayStatsBuffer.emplace(logicalDevice, sizeof(RayStats), vk::BufferUsageFlagBits::eStorageBuffer, pQueues);
+            device.rayStatsBuffer->Allocate(memoryArena, {
+                vk::MemoryPropertyFlagBits::eHostVisible | vk::MemoryPropertyFlagBits::eHostCoherent,
+                vk::MemoryPropertyFlagBits::eHostVisible
+            });
+            device.rayStatsBuffer->Bind();
+
+            std::memset(device.rayStatsBuffer->MapMemory(), 0, sizeof(RayStats));
+            device.rayStatsBuffer->FlushMappedMemory();
+        }
+
+        { // Create Command Pools & Buffers
+            const ProfileScope profileScope(profiler, "Create Command Buffers");
+
+            const auto commandPoolCreateInfo = vk::CommandPoolCreateInfo(vk::CommandPoolCreateFlagBits::eResetCommandBuffer, device.computeQueueIndex);
+            device.commandPool = logicalDevice.createCommandPool(commandPoolCreateInfo);
+
+            const auto commandBufferAllocateInfo = vk::CommandBufferAllocateInfo(device.commandPool, vk::CommandBufferLevel::ePrimary, submitSlotCount);
+            device.commandBuffers = logicalDevice.allocateCommandBuffers(commandBufferAllocateInfo);
+
+            if (device.bDedicatedTransferQueue) {
+                const auto transferCommandPoolCreateInfo = vk::CommandPoolCreateInfo(vk::CommandPoolCreateFlagBits::eResetCommandBuffer, device.transferQueueIndex);
+                device.transferCommandPool = logicalDevice.createCommandPool(transferCommandPoolCreateInfo);
+
+                const auto transferCommandBufferAllocateInfo = vk::CommandBufferAllocateInfo(device.transferCommandPool, vk::CommandBufferLevel::ePrimary, submitSlotCount);
+                device.transferCommandBuffers = logicalDevice.allocateCommandBuffers(transferCommandBufferAllocateInfo);
+            }
+        }
+
+        { // Create Synch Objects
+            // Signaled So That The First Use Of Every Slot Doesn't Block
+            const auto fenceCreateInfo = vk::FenceCreateInfo(vk::FenceCreateFlagBits::eSignaled);
+
+            device.fences.resize(submitSlotCount);
+            for (vk::Fence& fence : device.fences)
+                fence = logicalDevice.createFence(fenceCreateInfo);
+
+            if (device.bDedicatedTransferQueue) {
+                device.transferFences.resize(submitSlotCount);
+                device.tileCompleteSemaphores.resize(submitSlotCount);
+
+                for (vk::Fence& fence : device.transferFences)
+                    fence = logicalDevice.createFence(fenceCreateInfo);
+
+                for (vk::Semaphore& semaphore : device.tileCompleteSemaphores)
+                    semaphore = logicalDevice.createSemaphore(vk::SemaphoreCreateInfo(vk::SemaphoreCreateFlags{}));
+            }
+        }
+
+        device.timestampValidBits = device.queueFamilyProperties[device.computeQueueIndex].timestampValidBits;
+        device.bGpuTimestamps     = profiler.IsEnabled() && device.timestampValidBits > 0u;
+        device.slotHasTimestamps.assign(submitSlotCount, false);
+
+        if (device.bGpuTimestamps) { // Create Timestamp Queries
+            const auto queryPoolCreateInfo = vk::QueryPoolCreateInfo(vk::QueryPoolCreateFlags{}, vk::QueryType::eTimestamp, 2u * submitSlotCount);
+            device.timestampQueryPool = logicalDevice.createQueryPool(queryPoolCreateInfo);
+        }
+    }
+
+    return context;
+}
+
+// Frees A Device's Frame Slots, When A Job Needs Larger Ones Or When The Device Is Destroyed
+void DestroyFrameResources(GpuDevice& device) {
+    for (FrameResources& frame : device.frameResources) {
+        device.logicalDevice.destroyFence(frame.readbackFence);
+        device.logicalDevice.destroySemaphore(frame.readbackSemaphore);
+        for (VulkanBuffer* pBuffer : { &frame.accumulationBuffer, &frame.stagingBuffer, &frame.momentsBuffer, &frame.pixelListHeaderBuffer, &frame.pixelListBuffer, &frame.aovBuffer,
+                                       &frame.resolvedBuffer }) {
+            pBuffer->UnAllocate();
+            pBuffer->Destroy();
+        }
+    }
+
+    device.frameResources.clear();
+    device.framePixelCapacity      = 0u;
+    device.frameTileCapacity       = 0u;
+    device.frameAccumulationStride = 0u;
+    device.frameStagingStride      = 0u;
+    device.frameResolvedStride     = 0u;
+}
+
+// Renders A Job's Frames On The Context's Devices. Their Frame Buffers & Wavefront Queues Are Only Created Again When They Are
+// Too Small For The Job & Pipelines Are Built Once Per Specialization (See GpuDevice), So Repeated Jobs Start Tracing Right Away
+// 'bNewScene' Uploads The Scene, Which Stays On The Devices For The Following Jobs
+JobTimings RenderGpuJob(GpuContext& context, const CommandLineArguments& commandLineArguments, const Scene& scene, const bool bNewScene,
+                        const std::vector<Camera>& cameras, Checkpointer& checkpointer, Profiler& profiler, Profiler::Counters& profileCounters) {
+    std::vector<std::unique_ptr<GpuDevice>>& devices = context.devices;
+
+    JobTimings timings;
+    timings.bReusedBuffers     = true;
+    timings.bReusedPipelines   = true;
+    timings.bReusedDescriptors = true;
+
+    const auto prepareStart = std::chrono::steady_clock::now();
+
+    const bool          bAdaptive      = commandLineArguments.adaptiveThreshold > 0.f;
+    const std::uint32_t tileSize       = commandLineArguments.tileSize;
+
+    // Out Of Core, Each Tile Of A Frame Is Rendered As A Region Of Its Own, So That The Buffers Never Hold More Than One Tile
+    // Otherwise A Frame Is A Single Region. Below 'tileCount' & 'pixelCount' Are Per Region (At Most)
+    const bool          bOutOfCore      = commandLineArguments.bOutOfCore;
+    const std::uint32_t frameTileCountX = (commandLineArguments.surfaceWidth  + tileSize - 1u) / tileSize;
+    const std::uint32_t frameTileCountY = (commandLineArguments.surfaceHeight + tileSize - 1u) / tileSize;
+    const std::uint64_t regionCount     = bOutOfCore ? (static_cast<std::uint64_t>(frameTileCountX) * frameTileCountY) : 1u; // Per Frame
+    const std::uint32_t tileCountX      = bOutOfCore ? 1u : frameTileCountX;
+    const std::uint32_t tileCountY      = bOutOfCore ? 1u : frameTileCountY;
+    const std::uint32_t tileCount       = tileCountX * tileCountY;
+    const size_t        pixelCount      = bOutOfCore ?
+        (static_cast<size_t>(std::min(tileSize, commandLineArguments.surfaceWidth)) * std::min(tileSize, commandLineArguments.surfaceHeight)) :
+        (static_cast<size_t>(commandLineArguments.surfaceWidth) * commandLineArguments.surfaceHeight);
+
+    // A Half Accumulation Counts Up To MAX_HALF_ACCUMULATION_SAMPLES Samples Per Pixel & Stays Accurate Over MAX_HALF_ACCUMULATION_PASSES Passes
+    AccumulationFormat accumulationFormat = commandLineArguments.accumulationFormat;
+    if (accumulationFormat == AccumulationFormat::eRGBA16F) {
+        const std::uint64_t samplesPerPass = std::max(1u, std::min(commandLineArguments.samplesPerPass, checkpointer.GetSampleCount()));
+        const std::uint64_t passCount      = (checkpointer.GetSampleCount() + samplesPerPass - 1u) / samplesPerPass;
+
+        if (checkpointer.GetSampleCount() > MAX_HALF_ACCUMULATION_SAMPLES) {
+            std::printf("--accumulation rgba16f Holds Up To %u Samples Per Pixel, Using rgba32f\n", MAX_HALF_ACCUMULATION_SAMPLES);
+            accumulationFormat = AccumulationFormat::eRGBA32F;
+        } else if (passCount > MAX_HALF_ACCUMULATION_PASSES) {
+            std::printf("--accumulation rgba16f Drifts Over More Than %u Passes (This Job Has %llu), Using rgba32f, Raise --spp-per-pass To Keep It\n",
+                MAX_HALF_ACCUMULATION_PASSES, static_cast<unsigned long long>(passCount));
+            accumulationFormat = AccumulationFormat::eRGBA32F;
+        }
+    }
+
+    // Each Device Only Holds The Samples It Traced, Which The Host Sums Before Resolving
+    GpuResolve resolve = commandLineArguments.gpuResolve;
+    if (resolve != GpuResolve::eHost && devices.size() > 1u) {
+        std::printf("--resolve Is Ignored With Several Devices, Their Accumulations Are Summed On The Host\n");
+        resolve = GpuResolve::eHost;
+    }
+
+    // The Denoiser & AOV Exports Need The Accumulation Itself. The Command Line Already Drops --resolve, Jobs (serve, bench suite) May Still Combine Them
+    if (resolve != GpuResolve::eHost && commandLineArguments.bAovs) {
+        std::printf("--resolve Is Ignored With --denoise & --aov\n");
+        resolve = GpuResolve::eHost;
+    }
+
+    // Bytes Per Pixel: The Staging Buffer Receives The Accumulation (Or The Resolved Pixels), Then The AOVs
+    const bool          bHalfAccumulation  = accumulationFormat == AccumulationFormat::eRGBA16F;
+    const bool          bGpuResolve        = resolve != GpuResolve::eHost;
+    const std::uint32_t accumulationStride = bHalfAccumulation ? (2u * sizeof(std::uint32_t)) : sizeof(Colorf32);
+    const std::uint32_t resolvedStride     = bGpuResolve ? sizeof(std::uint32_t) : 0u;
+    const std::uint32_t stagingStride      = (bGpuResolve ? resolvedStride : accumulationStride) + (commandLineArguments.bAovs ? (2u * sizeof(Colorf32)) : 0u);
+    const size_t        aovStagingOffset   = pixelCount * (bGpuResolve ? resolvedStride : accumulationStride);
+
+    // A Frame Slot Holds One Region, Regions Are Rendered In Order (Jobs) & Pipelined Over The Slots Like Frames
+    const std::uint64_t jobCount       = commandLineArguments.frameCount * regionCount;
+    const std::uint32_t frameSlotCount = static_cast<std::uint32_t>(std::min<std::uint64_t>(MAX_FRAME_SLOTS, jobCount));
+
+    // The Wavefront Queues Hold Every (Pixel, Sample) Of One Submit. Each Device's Are Shared By All Its Frames & Submits,
+    // Which Execute In Submission Order On Its Compute Queue
+    const bool          bWavefront        = commandLineArguments.gpuKernel == GpuKernel::eWavefront;
+    const std::uint64_t wavefrontCapacity = static_cast<std::uint64_t>(std::min<std::uint32_t>(commandLineArguments.tileSize, commandLineArguments.surfaceWidth)) *
+        std::min<std::uint32_t>(commandLineArguments.tileSize, commandLineArguments.surfaceHeight) * std::min(commandLineArguments.samplesPerPass, commandLineArguments.samplesPerPixel);
+
+    if (bWavefront)
+        std::printf("Wavefront Queues: %llu Paths (%.1f MiB Per Device)\n", static_cast<unsigned long long>(wavefrontCapacity),
+            wavefrontCapacity * (2u * sizeof(WavefrontPath) + sizeof(WavefrontHit) + (commandLineArguments.bAovs ? 3u : 1u) * sizeof(Colorf32)) / (1024.0 * 1024.0));
+
+    // Each Submit Renders One Tile For One Pass Using Its Own Command Buffer & Fence
+    // During The Final Pass, Each Tile Is Copied To The Staging Buffer As Soon As It Completes,
+    // Overlapping The Readback With The Remaining Tiles' Compute
+    const std::uint32_t submitSlotCount = commandLineArguments.maxSubmitsInFlight;
+
+    for (const std::unique_ptr<GpuDevice>& pDevice : devices) {
+        GpuDevice&         device      = *pDevice;
+        VulkanMemoryArena& memoryArena = *device.memoryArena;
+
+        const vk::Device&                logicalDevice = device.logicalDevice;
+        const std::vector<std::uint32_t> pQueues       = { device.computeQueueIndex, device.transferQueueIndex };
+
+        device.tileCount = 0u; // The Scheduler's Split Is Reported Per Job
+
+        // The Descriptor Sets Only Go Stale When A Buffer They Point At Is Created Again
+        bool bWriteDescriptors = bNewScene;
+
+        // A Job That Fits In The Previous Jobs' Frame Buffers Reuses Them, Otherwise They Are Created For The Largest Job Yet
+        if (device.frameResources.size() < frameSlotCount || device.framePixelCapacity < pixelCount || device.frameTileCapacity < tileCount ||
+            device.frameAccumulationStride < accumulationStride || device.frameStagingStride < stagingStride || device.frameResolvedStride < resolvedStride) { // Create Buffers
+            const ProfileScope profileScope(profiler, "Create Buffers");
+
+            const std::uint32_t slotCapacity            = std::max(static_cast<std::uint32_t>(device.frameResources.size()), frameSlotCount);
+            const size_t        framePixelCapacity      = std::max(device.framePixelCapacity, pixelCount);
+            const std::uint32_t frameTileCapacity       = std::max(device.frameTileCapacity, tileCount);
+            const std::uint32_t frameAccumulationStride = std::max(device.frameAccumulationStride, accumulationStride);
+            const std::uint32_t frameStagingStride      = std::max(device.frameStagingStride, stagingStride);
+            const std::uint32_t frameResolvedStride     = std::max(device.frameResolvedStride, resolvedStride);
+
+            DestroyFrameResources(device);
+            timings.bReusedBuffers = false;
+            bWriteDescriptors      = true;
+
+            // The Shaders Keep Their Bindings Without --adaptive, But Never Touch These Buffers
+            const size_t momentsBufferSize         = bAdaptive ? (framePixelCapacity * 2u * sizeof(float)) : 256u;
+            const size_t pixelListHeaderBufferSize = bAdaptive ? (static_cast<size_t>(frameTileCapacity) * sizeof(PixelListHeader)) : 256u;
+            const size_t pixelListBufferSize       = bAdaptive ? (framePixelCapacity * sizeof(std::uint32_t)) : 256u;
+            const size_t aovBufferSize             = commandLineArguments.bAovs ? (2u * framePixelCapacity * sizeof(Colorf32)) : 256u;
+            const size_t resolvedBufferSize        = (frameResolvedStride > 0u) ? (framePixelCapacity * frameResolvedStride) : 256u;
+
+            device.frameResources.reserve(slotCapacity);
+            for (std::uint32_t i = 0u; i < slotCapacity; i++) {
+                FrameResources& frame = device.frameResources.emplace_back();
+
+                // The Accumulation Buffer Only Lives In VRAM, The Shader Never Writes Over PCIe
+                frame.accumulationBuffer = VulkanBuffer(logicalDevice, framePixelCapacity * frameAccumulationStride,
+                    vk::BufferUsageFlagBits::eStorageBuffer | vk::BufferUsageFlagBits::eTransferSrc | vk::BufferUsageFlagBits::eTransferDst, pQueues);
+                // The Frame's Tiles Are Copied Here For The Host To Read, Cached Memory Makes The Host's Reads Fast
+                frame.stagingBuffer         = VulkanBuffer(logicalDevice, framePixelCapacity * frameStagingStride, vk::BufferUsageFlagBits::eTransferDst, pQueues);
+                frame.momentsBuffer         = VulkanBuffer(logicalDevice, momentsBufferSize, vk::BufferUsageFlagBits::eStorageBuffer | vk::BufferUsageFlagBits::eTransferDst, pQueues);
+                frame.pixelListHeaderBuffer = VulkanBuffer(logicalDevice, pixelListHeaderBufferSize, vk::BufferUsageFlagBits::eStorageBuffer |
+                    vk::BufferUsageFlagBits::eIndirectBuffer | vk::BufferUsageFlagBits::eTransferSrc | vk::BufferUsageFlagBits::eTransferDst, pQueues);
+                frame.pixelListBuffer       = VulkanBuffer(logicalDevice, pixelListBufferSize, vk::BufferUsageFlagBits::eStorageBuffer, pQueues);
+                frame.aovBuffer             = VulkanBuffer(logicalDevice, aovBufferSize,
+                    vk::BufferUsageFlagBits::eStorageBuffer | vk::BufferUsageFlagBits::eTransferSrc | vk::BufferUsageFlagBits::eTransferDst, pQueues);
+                frame.resolvedBuffer        = VulkanBuffer(logicalDevice, resolvedBufferSize, vk::BufferUsageFlagBits::eStorageBuffer | vk::BufferUsageFlagBits::eTransferSrc, pQueues);
+
+                frame.accumulationBuffer.Allocate(memoryArena, { vk::MemoryPropertyFlagBits::eDeviceLocal, vk::MemoryPropertyFlags{} });
+                frame.accumulationBuffer.Bind();
+
+                frame.stagingBuffer.Allocate(memoryArena, {
+                    vk::MemoryPropertyFlagBits::eHostVisible | vk::MemoryPropertyFlagBits::eHostCached,
+                    vk::MemoryPropertyFlagBits::eHostVisible | vk::MemoryPropertyFlagBits::eHostCoherent,
+                    vk::MemoryPropertyFlagBits::eHostVisible
+                });
+                frame.stagingBuffer.Bind();
+
+                frame.momentsBuffer.Allocate(memoryArena, { vk::MemoryPropertyFlagBits::eDeviceLocal, vk::MemoryPropertyFlags{} });
+                frame.momentsBuffer.Bind();
+
+                // The Host Reads The Headers' Counts Between Passes To Know How Many Pixels Are Left
+                frame.pixelListHeaderBuffer.Allocate(memoryArena, {
+                    vk::MemoryPropertyFlagBits::eHostVisible | vk::MemoryPropertyFlagBits::eHostCoherent,
+                    vk::MemoryPropertyFlagBits::eHostVisible
+                });
+                frame.pixelListHeaderBuffer.Bind();
+
+                frame.pixelListBuffer.Allocate(memoryArena, { vk::MemoryPropertyFlagBits::eDeviceLocal, vk::MemoryPropertyFlags{} });
+                frame.pixelListBuffer.Bind();
+
+                frame.aovBuffer.Allocate(memoryArena, { vk::MemoryPropertyFlagBits::eDeviceLocal, vk::MemoryPropertyFlags{} });
+                frame.aovBuffer.Bind();
+
+                frame.resolvedBuffer.Allocate(memoryArena, { vk::MemoryPropertyFlagBits::eDeviceLocal, vk::MemoryPropertyFlags{} });
+                frame.resolvedBuffer.Bind();
+
+                frame.readbackFence     = logicalDevice.createFence(vk::FenceCreateInfo(vk::FenceCreateFlagBits::eSignaled));
+                frame.readbackSemaphore = logicalDevice.createSemaphore(vk::SemaphoreCreateInfo(vk::SemaphoreCreateFlags{}));
+            }
+
+            device.framePixelCapacity      = framePixelCapacity;
+            device.frameTileCapacity       = frameTileCapacity;
+            device.frameAccumulationStride = frameAccumulationStride;
+            device.frameStagingStride      = frameStagingStride;
+            device.frameResolvedStride     = frameResolvedStride;
+        }
+
+        // Paths (Two Queues), Hits, Queue Headers, Sample Radiance & AOVs, At wavefront.glsl's Set 1 Bindings 0-4
+        if (bWavefront && device.wavefrontCapacity < wavefrontCapacity) { // Create The Wavefront Queues
+            if ((wavefrontCapacity + WAVEFRONT_WORKGROUP_SIZE - 1u) / WAVEFRONT_WORKGROUP_SIZE > device.properties.limits.maxComputeWorkGroupCount[0])
+                throw std::runtime_error("The Wavefront Queues Need Too Many Workgroups On " + device.name + ", Lower --tile Or --spp-per-pass");
+
+            for (VulkanBuffer& buffer : device.wavefrontBuffers) {
+                buffer.UnAllocate();
+                buffer.Destroy();
+            }
+
+            device.wavefrontBuffers.clear();
+            device.wavefrontCapacity = 0u;
+            timings.bReusedBuffers   = false;
+            bWriteDescriptors        = true;
+
+            const vk::BufferUsageFlags storageUsage = vk::BufferUsageFlagBits::eStorageBuffer;
+            device.wavefrontBuffers.reserve(5u);
+            device.wavefrontBuffers.emplace_back(logicalDevice, 2u * wavefrontCapacity * sizeof(WavefrontPath), storageUsage, pQueues);
+            device.wavefrontBuffers.emplace_back(logicalDevice, wavefrontCapacity * sizeof(WavefrontHit), storageUsage, pQueues);
+            device.wavefrontBuffers.emplace_back(logicalDevice, 2u * sizeof(WavefrontQueue), storageUsage | vk::BufferUsageFlagBits::eIndirectBuffer | vk::BufferUsageFlagBits::eTransferDst, pQueues);
+            device.wavefrontBuffers.emplace_back(logicalDevice, wavefrontCapacity * sizeof(Colorf32), storageUsage, pQueues);
+            device.wavefrontBuffers.emplace_back(logicalDevice, commandLineArguments.bAovs ? (2u * wavefrontCapacity * sizeof(Colorf32)) : 256u, storageUsage, pQueues);
+
+            for (VulkanBuffer& buffer : device.wavefrontBuffers) {
+                buffer.Allocate(memoryArena, { vk::MemoryPropertyFlagBits::eDeviceLocal, vk::MemoryPropertyFlags{} });
+                buffer.Bind();
+            }
+
+            device.wavefrontCapacity = wavefrontCapacity;
+        }
+
+        if (bNewScene) { // Upload The Scene: One Copy From The (Mapped) File Into Staging, One Copy On The GPU
+            const ProfileScope profileScope(profiler, "Upload Scene");
+
+            if (device.sceneBuffer) {
+                device.sceneBuffer->UnAllocate();
+                device.sceneBuffer->Destroy();
+            }
+
+            // The Scene's Sections Share One Buffer, Each Bound At Its Own 256-Byte Aligned Offset
+            device.sceneBuffer.emplace(logicalDevice, scene.GetGpuDataSize(), vk::BufferUsageFlagBits::eStorageBuffer | vk::BufferUsageFlagBits::eTransferDst, pQueues);
+            device.sceneBuffer->Allocate(memoryArena, { vk::MemoryPropertyFlagBits::eDeviceLocal, vk::MemoryPropertyFlags{} });
+            device.sceneBuffer->Bind();
+
+            VulkanBuffer uploadBuffer(logicalDevice, scene.GetGpuDataSize(), vk::BufferUsageFlagBits::eTransferSrc, pQueues);
+            uploadBuffer.Allocate(memoryArena, {
+                vk::MemoryPropertyFlagBits::eHostVisible | vk::MemoryPropertyFlagBits::eHostCoherent,
+                vk::MemoryPropertyFlagBits::eHostVisible
+            });
+            uploadBuffer.Bind();
+
+            std::memcpy(uploadBuffer.MapMemory(), scene.GetGpuData(), scene.GetGpuDataSize());
+            uploadBuffer.FlushMappedMemory();
+
+            // Borrow The First Submit Slot, Its Fence Is Signaled Again Once The Upload Completes
+            const vk::CommandBuffer& commandBuffer = device.commandBuffers[0];
+            commandBuffer.begin(vk::CommandBufferBeginInfo(vk::CommandBufferUsageFlagBits::eOneTimeSubmit, nullptr));
+
+            const auto sceneCopy = vk::BufferCopy(0u, 0u, scene.GetGpuDataSize());
+            commandBuffer.copyBuffer(uploadBuffer.GetBuffer(), device.sceneBuffer->GetBuffer(), 1u, &sceneCopy);
+
+            const auto uploadBarrier = vk::MemoryBarrier(vk::AccessFlagBits::eTransferWrite, vk::AccessFlagBits::eShaderRead);
+            commandBuffer.pipelineBarrier(vk::PipelineStageFlagBits::eTransfer, vk::PipelineStageFlagBits::eComputeShader, vk::DependencyFlags{}, 1u, &uploadBarrier, 0u, nullptr, 0u, nullptr);
+
+            commandBuffer.end();
+
+            logicalDevice.resetFences(1u, &device.fences[0]);
+            const auto submitInfo = vk::SubmitInfo(0u, nullptr, nullptr, 1u, &commandBuffer, 0u, nullptr);
+            device.computeQueue.submit(1u, &submitInfo, device.fences[0]);
+            logicalDevice.waitForFences(1u, &device.fences[0], VK_TRUE, UINT64_MAX);
+
+            uploadBuffer.UnAllocate();
+            uploadBuffer.Destroy();
+        }
+
+        if (bWriteDescriptors) { // Write The Descriptors
+            // Every Set Is Allocated Again, Since The Pool Only Holds One Per Frame Slot (& The Wavefront Queues')
+            logicalDevice.resetDescriptorPool(device.descriptorPool);
+            timings.bReusedDescriptors = false;
+
+            if (bWavefront) {
+                const auto descriptorSetAllocateInfo = vk::DescriptorSetAllocateInfo(device.descriptorPool, 1u, &device.wavefrontDescriptorSetLayout);
+                device.wavefrontDescriptorSet = std::move(logicalDevice.allocateDescriptorSets(descriptorSetAllocateInfo)[0]);
+
+                std::array<vk::DescriptorBufferInfo, 5u> descriptorBufferInfos;
+                std::array<vk::WriteDescriptorSet, 5u>   writeDescriptorSets;
+                for (std::uint32_t binding = 0u; binding < writeDescriptorSets.size(); binding++) {
+                    descriptorBufferInfos[binding] = device.wavefrontBuffers[binding].GetDescriptorBufferInfo();
+                    writeDescriptorSets[binding]   = vk::WriteDescriptorSet(device.wavefrontDescriptorSet, binding, 0u, 1u, vk::DescriptorType::eStorageBuffer, nullptr, &descriptorBufferInfos[binding]);
+                }
+
+                logicalDevice.updateDescriptorSets(static_cast<std::uint32_t>(writeDescriptorSets.size()), writeDescriptorSets.data(), 0, nullptr);
+            }
+
+            for (FrameResources& frame : device.frameResources) {
+                // Allocate Descriptor Set
+                auto descriptorSetAllocateInfo = vk::DescriptorSetAllocateInfo(device.descriptorPool, 1u, &device.descriptorSetLayout);
+                frame.descriptorSet = std::move(logicalDevice.allocateDescriptorSets(descriptorSetAllocateInfo)[0]);
+
+                // Initialize Descriptor Set
+                auto GetSceneSectionBufferInfo = [&](const SceneSection section) {
+                    return vk::DescriptorBufferInfo(device.sceneBuffer->GetBuffer(), scene.GetSectionOffset(section), scene.GetSectionSize(section));
+                };
+
+                const std::array<vk::DescriptorBufferInfo, 13u> descriptorBufferInfos = {
+                    frame.accumulationBuffer.GetDescriptorBufferInfo(),
+                    device.rayStatsBuffer->GetDescriptorBufferInfo(),
+                    GetSceneSectionBufferInfo(eSceneSectionMaterials),
+                    GetSceneSectionBufferInfo(eSceneSectionSpheres),
+                    GetSceneSectionBufferInfo(eSceneSectionPlanes),
+                    GetSceneSectionBufferInfo(eSceneSectionTriangles),
+                    GetSceneSectionBufferInfo(eSceneSectionBvhNodes),
+                    GetSceneSectionBufferInfo(eSceneSectionLights),
+                    frame.momentsBuffer.GetDescriptorBufferInfo(),
+                    frame.pixelListHeaderBuffer.GetDescriptorBufferInfo(),
+                    frame.pixelListBuffer.GetDescriptorBufferInfo(),
+                    frame.aovBuffer.GetDescriptorBufferInfo(),
+                    frame.resolvedBuffer.GetDescriptorBufferInfo()
+                };
+
+                std::array<vk::WriteDescriptorSet, 13u> writeDescriptorSets;
+                for (std::uint32_t binding = 0u; binding < writeDescriptorSets.size(); binding++)
+                    writeDescriptorSets[binding] = vk::WriteDescriptorSet(frame.descriptorSet, binding, 0u, 1u, vk::DescriptorType::eStorageBuffer, nullptr, &descriptorBufferInfos[binding]);
+                logicalDevice.updateDescriptorSets(static_cast<std::uint32_t>(writeDescriptorSets.size()), writeDescriptorSets.data(), 0, nullptr);
+            }
+        }
+
+        if (bGpuResolve && !device.resolveShaderModule) { // Create The Resolve Shader Module
+            const ProfileScope profileScope(profiler, "Load Shader resolve.glsl");
+
+            const std::vector<std::uint32_t> spirv = LoadShaderSpirv("resolve.glsl", ShaderDefines{}, commandLineArguments.cacheDirectory);
+            const auto shaderModuleCreateInfo = vk::ShaderModuleCreateInfo(vk::ShaderModuleCreateFlags{}, spirv.size() * sizeof(std::uint32_t), spirv.data());
+            device.resolveShaderModule = logicalDevice.createShaderModule(shaderModuleCreateInfo);
+        }
+
+        { // Specialize The Pipelines
+            // Only These Change Between Jobs, The Other Constants Hold For The Context's Lifetime
+            const std::array<std::uint32_t, 6u> specialization = {
+                commandLineArguments.surfaceWidth, commandLineArguments.surfaceHeight, commandLineArguments.maxBounces,
+                static_cast<std::uint32_t>(accumulationFormat), static_cast<std::uint32_t>(resolve), static_cast<std::uint32_t>(commandLineArguments.toneMapping)
+            };
+
+            auto specializedPipelines = device.specializedPipelines.find(specialization);
+            if (specializedPipelines == device.specializedPipelines.end()) {
+                const auto pipelineBuildStart = std::chrono::steady_clock::now();
+
+                const ProfileScope profileScope(profiler, "Create Pipeline");
+
+                // Specialize The Shader For This Job
+                SpecializationConstants specializationConstants;
+                specializationConstants.workgroupSize          = device.workgroupSize;
+                specializationConstants.width                  = commandLineArguments.surfaceWidth;
+                specializationConstants.height                 = commandLineArguments.surfaceHeight;
+                specializationConstants.maxIterations          = commandLineArguments.maxBounces;
+                specializationConstants.profile                = profiler.IsEnabled() ? VK_TRUE : VK_FALSE;
+                specializationConstants.wavefrontWorkgroupSize = WAVEFRONT_WORKGROUP_SIZE;
+                specializationConstants.sampleSequence         = static_cast<std::uint32_t>(commandLineArguments.sampleSequence);
+                specializationConstants.adaptive               = bAdaptive ? VK_TRUE : VK_FALSE;
+                specializationConstants.adaptiveThreshold      = commandLineArguments.adaptiveThreshold;
+                specializationConstants.adaptiveMinSamples     = commandLineArguments.adaptiveMinSamples;
+                specializationConstants.aov                    = commandLineArguments.bAovs ? VK_TRUE : VK_FALSE;
+                specializationConstants.outOfCore              = bOutOfCore ? VK_TRUE : VK_FALSE;
+                specializationConstants.accumulationHalf       = bHalfAccumulation ? VK_TRUE : VK_FALSE;
+                specializationConstants.resolve                = static_cast<std::uint32_t>(resolve);
+                specializationConstants.toneMapping            = static_cast<std::uint32_t>(commandLineArguments.toneMapping);
+
+                const std::array<vk::SpecializationMapEntry, 15u> specializationMapEntries = {
+                    vk::SpecializationMapEntry(0u, offsetof(SpecializationConstants, workgroupSize),          sizeof(std::uint32_t)),
+                    vk::SpecializationMapEntry(1u, offsetof(SpecializationConstants, width),                  sizeof(std::uint32_t)),
+                    vk::SpecializationMapEntry(2u, offsetof(SpecializationConstants, height),                 sizeof(std::uint32_t)),
+                    vk::SpecializationMapEntry(3u, offsetof(SpecializationConstants, maxIterations),          sizeof(std::uint32_t)),
+                    vk::SpecializationMapEntry(4u, offsetof(SpecializationConstants, profile),                sizeof(std::uint32_t)),
+                    vk::SpecializationMapEntry(5u, offsetof(SpecializationConstants, wavefrontWorkgroupSize), sizeof(std::uint32_t)),
+                    vk::SpecializationMapEntry(6u, offsetof(SpecializationConstants, sampleSequence),         sizeof(std::uint32_t)),
+                    vk::SpecializationMapEntry(7u, offsetof(SpecializationConstants, adaptive),               sizeof(std::uint32_t)),
+                    vk::SpecializationMapEntry(8u, offsetof(SpecializationConstants, adaptiveThreshold),      sizeof(float)),
+                    vk::SpecializationMapEntry(9u, offsetof(SpecializationConstants, adaptiveMinSamples),     sizeof(std::uint32_t)),
+                    vk::SpecializationMapEntry(10u, offsetof(SpecializationConstants, aov),                   sizeof(std::uint32_t)),
+                    vk::SpecializationMapEntry(11u, offsetof(SpecializationConstants, outOfCore),             sizeof(std::uint32_t)),
+                    vk::SpecializationMapEntry(12u, offsetof(SpecializationConstants, accumulationHalf),      sizeof(std::uint32_t)),
+                    vk::SpecializationMapEntry(13u, offsetof(SpecializationConstants, resolve),               sizeof(std::uint32_t)),
+                    vk::SpecializationMapEntry(14u, offsetof(SpecializationConstants, toneMapping),           sizeof(std::uint32_t))
+                };
+
+                const auto specializationInfo = vk::SpecializationInfo(
+                    static_cast<std::uint32_t>(specializationMapEntries.size()), specializationMapEntries.data(),
+                    sizeof(SpecializationConstants), &specializationConstants
+                );
+                // resolve.glsl's Pipeline Follows The Modules' When The Job Resolves On The GPU
+                std::vector<vk::ShaderModule> shaderModules = device.shaderModules;
+                if (bGpuResolve)
+                    shaderModules.push_back(device.resolveShaderModule);
+
+                std::vector<vk::Pipeline> pipelines;
+                for (const vk::ShaderModule& shaderModule : shaderModules) {
+                    const auto shaderStageCreateInfo = vk::PipelineShaderStageCreateInfo(
+                        vk::PipelineShaderStageCreateFlags{}, vk::ShaderStageFlagBits::eCompute,
+                        shaderModule, "main", &specializationInfo
+                    );
+
+                    const auto computePipelineCreateInfo = vk::ComputePipelineCreateInfo(
+                        vk::PipelineCreateFlags{}, shaderStageCreateInfo, device.computePipelineLayout, {}, 0
+                    );
+
+                    pipelines.push_back(logicalDevice.createComputePipeline(device.pipelineCache, computePipelineCreateInfo).value);
+                }
+
+                specializedPipelines     = device.specializedPipelines.emplace(specialization, std::move(pipelines)).first;
+                timings.bReusedPipelines = false;
+
+                std::printf("Pipeline Ready On %s In %.3fms\n", device.name.c_str(), std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - pipelineBuildStart).count());
+
+                SavePipelineCache(logicalDevice, device.pipelineCache, device.pipelineCachePath);
+            }
+
+            // One Pipeline Per Shader Module, adaptive.glsl's Last, Then resolve.glsl's
+            const std::vector<vk::Pipeline>& pipelines = specializedPipelines->second;
+
+            if (bAdaptive)
+                device.adaptivePipeline = pipelines[device.shaderModules.size() - 1u];
+
+            device.resolvePipeline = bGpuResolve ? pipelines.back() : vk::Pipeline{};
+
+            if (bWavefront)
+                std::copy(pipelines.begin(), pipelines.begin() + WAVEFRONT_STAGE_COUNT, device.wavefrontPipelines.begin());
+            else
+                device.computePipeline = pipelines[0];
+        }
+    }
+
+    timings.prepareSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - prepareStart).count();
+
+    { // Run
+        const std::uint32_t frameCount = commandLineArguments.frameCount;
+
+        // The Host's Side Of A Frame Slot, Whose Buffers Exist On Every Device
+        struct FrameSlot {
+            std::shared_future<void>   encodeJob;              // Resolves & Saves The Frame (Streams The Region Out Of Core) Once Read Back
+            std::uint32_t              frameIndex = 0u;
+            FrameRegion                region;                 // The Part Of The Frame The Slot's Buffers Hold
+            std::uint64_t              sampleCount = 0u;       // The Samples Traced, Completed Once The Final Pass Retires
+            std::uint32_t              listedSampleCount = 0u; // The Final Pass' Samples Per Listed Pixel, 0 Unless It Was Adaptive
+            std::uint32_t              samplesPerPixel = 0u;   // The Samples Per Pixel The Frame's Passes Took
+            std::vector<std::uint32_t> tileDevices;            // With --adaptive, The Device Each Tile Stays On (Its Moments & List Live There)
+            std::vector<Colorf32>      merged;                 // The Sum Of The Devices' Staging Buffers, With Several Devices
+            std::vector<Coloru8>       resolved;               // Out Of Core, The Region Resolved For The Frame Streamer
+            double                     encodeSeconds = 0.0;    // How Long The Encode Job Took, Once It Completed
+        }; // FrameSlot
+
+        std::vector<FrameSlot> frameSlots(frameSlotCount);
+
+        // The Offset & Extent Of One Of A Region's Tiles
+        auto GetTile = [tileSize, tileCountX](const FrameRegion& region, const std::uint32_t tile) {
+            PassConstants tileConstants = {};
+            tileConstants.tileOffsetX = region.offsetX + (tile % tileCountX) * tileSize;
+            tileConstants.tileOffsetY = region.offsetY + (tile / tileCountX) * tileSize;
+            tileConstants.tileExtentX = std::min(tileSize, region.offsetX + region.width  - tileConstants.tileOffsetX);
+            tileConstants.tileExtentY = std::min(tileSize, region.offsetY + region.height - tileConstants.tileOffsetY);
+            return tileConstants;
+        };
+
+        // Sums A Frame's Staging Buffers, Each Holding The Samples One Device Traced, Over The Tiles It Traced
+        // The Accumulation & AOVs Are Sums Of Samples, So Adding Them Merges The Devices' Work Exactly. Half Accumulations Are Decoded On The Way
+        auto MergeReadbacks = [&devices, &commandLineArguments, &frameSlots, &GetTile, tileCount, pixelCount, bHalfAccumulation, aovStagingOffset](const std::uint32_t slot, std::vector<Colorf32>& merged) {
+            const FrameRegion& region = frameSlots[slot].region;
+            merged.assign(commandLineArguments.bAovs ? (3u * pixelCount) : pixelCount, Colorf32{ 0.f, 0.f, 0.f, 0.f });
+
+            auto Add = [](Colorf32& dst, const Colorf32& src) {
+                dst = Colorf32{ dst.r + src.r, dst.g + src.g, dst.b + src.b, dst.a + src.a };
+            };
+
+            for (const std::unique_ptr<GpuDevice>& pDevice : devices) {
+                const FrameResources& frame = pDevice->frameResources[slot];
+                frame.stagingBuffer.InvalidateMappedMemory();
+
+                const std::uint8_t*  pStagingBytes = reinterpret_cast<const std::uint8_t*>(frame.stagingBuffer.MapMemory());
+                const Colorf32*      pStaging      = reinterpret_cast<const Colorf32*>(pStagingBytes);
+                const std::uint32_t* pHalfStaging  = reinterpret_cast<const std::uint32_t*>(pStagingBytes);
+                const Colorf32*      pAovStaging   = reinterpret_cast<const Colorf32*>(pStagingBytes + aovStagingOffset);
+
+                ParallelFor(tileCount, 1u, [&](const size_t begin, const size_t end) {
+                    for (size_t tile = begin; tile < end; tile++) {
+                        if (!frame.tilesTraced[tile])
+                            continue;
+
+                        const PassConstants tileRect = GetTile(region, static_cast<std::uint32_t>(tile));
+
+                        for (std::uint32_t y = tileRect.tileOffsetY; y < tileRect.tileOffsetY + tileRect.tileExtentY; y++) {
+                            for (std::uint32_t x = tileRect.tileOffsetX; x < tileRect.tileOffsetX + tileRect.tileExtentX; x++) {
+                                const size_t p = region.GetIndex(x, y);
+                                Add(merged[p], bHalfAccumulation ? DecodeHalfAccumulation(pHalfStaging + 2u * p) : pStaging[p]);
+
+                                if (commandLineArguments.bAovs) {
+                                    Add(merged[pixelCount + 2u * p],      pAovStaging[2u * p]);
+                                    Add(merged[pixelCount + 2u * p + 1u], pAovStaging[2u * p + 1u]);
+                                }
+                            }
+                        }
+                    }
+                });
+            }
+        };
+
+        // Out Of Core, The Regions Are Resolved Concurrently But Handed To The Streamer In Order, Each Job Waiting For The Previous One
+        FrameStreamer            frameStreamer(commandLineArguments.surfaceWidth, commandLineArguments.surfaceHeight, commandLineArguments.outputFormat);
+        std::shared_future<void> lastEncodeJob;
+
+        // Merges (With Several Devices), Denoises, Resolves & Saves A Read Back Frame On A Worker Thread, Or Streams A Region Out Of Core
+        auto StartEncode = [&](const std::uint32_t slot) {
+            FrameSlot& frameSlot = frameSlots[slot];
+
+            auto Encode = [&commandLineArguments, &devices, &frameSlot, &profiler, &MergeReadbacks, &checkpointer, &frameStreamer, pixelCount, slot,
+                           resolve, bHalfAccumulation, frameIndex = frameSlot.frameIndex, previousEncodeJob = bOutOfCore ? lastEncodeJob : std::shared_future<void>(),
+                           filename = GetFrameOutputFilename(commandLineArguments, frameSlot.frameIndex)]() {
+                const FrameRegion& region = frameSlot.region;
+
+                // A Single Device Read Every Tile Back, So Its Staging Buffer Is Used As Is, Unless The Checkpoint's Samples Are Added
+                // Or Its Halves Decoded. Resolved On The GPU, It Holds One Word Per Pixel
+                const Colorf32* pAccumulation = nullptr;
+                if (resolve != GpuResolve::eHost) {
+                    const VulkanBuffer& stagingBuffer = devices[0]->frameResources[slot].stagingBuffer;
+                    stagingBuffer.InvalidateMappedMemory();
+                    const std::uint32_t* pResolved = reinterpret_cast<const std::uint32_t*>(stagingBuffer.MapMemory());
+
+                    // Already Tone Mapped, The Pixels Are Written As They Are
+                    if (resolve == GpuResolve::eRGBA8) {
+                        const Coloru8* pPixels = reinterpret_cast<const Coloru8*>(pResolved);
+
+                        if (commandLineArguments.bOutOfCore) {
+                            if (previousEncodeJob.valid())
+                                previousEncodeJob.wait();
+
+                            frameStreamer.AddRegion(filename, region, pPixels);
+                            return;
+                        }
+
+                        const ProfileScope profileScope(profiler, "Save Frame " + std::to_string(frameIndex));
+
+                        ImageWriter writer(filename, commandLineArguments.outputFormat, commandLineArguments.surfaceWidth, commandLineArguments.surfaceHeight);
+                        writer.WriteRows(pPixels, commandLineArguments.surfaceHeight);
+                        writer.Finish();
+                        return;
+                    }
+
+                    // Shared-Exponent Means Are Tone Mapped Like An Accumulation Of One Sample
+                    const ProfileScope profileScope(profiler, "Decode Frame " + std::to_string(frameIndex));
+
+                    frameSlot.merged.resize(region.GetPixelCount());
+                    ParallelFor(region.GetPixelCount(), 1u << 16, [&](const size_t begin, const size_t end) {
+                        for (size_t i = begin; i < end; i++)
+                            frameSlot.merged[i] = DecodeRGB9E5(pResolved[i]);
+                    });
+
+                    pAccumulation = frameSlot.merged.data();
+                } else if (devices.size() == 1u && !checkpointer.IsEnabled() && !bHalfAccumulation) {
+                    const VulkanBuffer& stagingBuffer = devices[0]->frameResources[slot].stagingBuffer;
+                    stagingBuffer.InvalidateMappedMemory();
+                    pAccumulation = reinterpret_cast<const Colorf32*>(stagingBuffer.MapMemory());
+                } else {
+                    const ProfileScope profileScope(profiler, "Merge Frame " + std::to_string(frameIndex));
+
+                    MergeReadbacks(slot, frameSlot.merged);
+                    pAccumulation = frameSlot.merged.data();
+
+                    if (checkpointer.IsEnabled()) {
+                        checkpointer.AddResumed(frameSlot.merged.data(), frameSlot.merged.data() + pixelCount);
+                        checkpointer.Write(frameSlot.merged.data(), frameSlot.merged.data() + pixelCount, frameSlot.samplesPerPixel);
+                    }
+                }
+
+                if (commandLineArguments.bOutOfCore) {
+                    frameSlot.resolved.resize(region.GetPixelCount());
+                    ResolveAccumulation(pAccumulation, frameSlot.resolved.data(), region.GetPixelCount(), commandLineArguments.toneMapping);
+
+                    if (previousEncodeJob.valid())
+                        previousEncodeJob.wait();
+
+                    frameStreamer.AddRegion(filename, region, frameSlot.resolved.data());
+                    return;
+                }
+
+                // The AOVs Follow The Accumulation
+                SaveFrame(commandLineArguments, pAccumulation, pAccumulation + pixelCount, filename, frameIndex, profiler);
+            };
+
+            frameSlot.encodeSeconds = 0.0;
+            frameSlot.encodeJob     = std::async(std::launch::async, [Encode, &frameSlot]() {
+                const auto encodeStart = std::chrono::steady_clock::now();
+                Encode();
+                frameSlot.encodeSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - encodeStart).count();
+            }).share();
+
+            lastEncodeJob = frameSlot.encodeJob;
+        };
+
+        // The Pixels The Last Adaptive Pass Listed Over All Tiles, Once Its Submits Have Retired
+        // Each Tile's Header Is Read On The Device The Tile Stays On
+        auto CountListedPixels = [&](const std::uint32_t slot) {
+            std::vector<const PixelListHeader*> deviceHeaders(devices.size());
+            for (size_t d = 0u; d < devices.size(); d++) {
+                const VulkanBuffer& pixelListHeaderBuffer = devices[d]->frameResources[slot].pixelListHeaderBuffer;
+                pixelListHeaderBuffer.InvalidateMappedMemory();
+                deviceHeaders[d] = reinterpret_cast<const PixelListHeader*>(pixelListHeaderBuffer.MapMemory());
+            }
+
+            std::uint64_t count = 0u;
+            for (std::uint32_t tile = 0u; tile < tileCount; tile++)
+                count += deviceHeaders[frameSlots[slot].tileDevices[tile]][tile].count;
+
+            return count;
+        };
+
+        // Jobs (A Region Of A Frame) Whose Final Copies Were Submitted, Oldest First
+        std::deque<std::pair<std::uint64_t, std::uint32_t>> framesInReadback; // Job, Slot
+        std::uint64_t                                       frameSampleCount = 0u; // Over The Regions Of The Frame Being Retired
+
+        // Hands Every Job Whose Readback Completed (On Every Device) To An Encoder, Waiting For Jobs Up To 'waitUntilJob'
+        auto RetireReadbacks = [&](const std::int64_t waitUntilJob) {
+            while (!framesInReadback.empty()) {
+                const auto [job, slot] = framesInReadback.front();
+                FrameSlot& frameSlot = frameSlots[slot];
+
+                if (static_cast<std::int64_t>(job) <= waitUntilJob) {
+                    const auto waitStart = std::chrono::steady_clock::now();
+                    for (const std::unique_ptr<GpuDevice>& pDevice : devices)
+                        pDevice->logicalDevice.waitForFences(1u, &pDevice->frameResources[slot].readbackFence, VK_TRUE, UINT64_MAX);
+                    profiler.AddToTotal("Wait For Readback", waitStart);
+                    timings.readbackWaitSeconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - waitStart).count();
+                }
+                else if (std::any_of(devices.begin(), devices.end(), [slot = slot](const std::unique_ptr<GpuDevice>& pDevice) {
+                    return pDevice->logicalDevice.getFenceStatus(pDevice->frameResources[slot].readbackFence) != vk::Result::eSuccess; }))
+                    break;
+
+                if (frameSlot.listedSampleCount > 0u)
+                    frameSlot.sampleCount += CountListedPixels(slot) * frameSlot.listedSampleCount;
+                profileCounters.samples += frameSlot.sampleCount;
+                frameSampleCount        += frameSlot.sampleCount;
+
+                // The Frame's Last Region Completes Its Count
+                const FrameRegion& region = frameSlot.region;
+                if (region.offsetX + region.width == commandLineArguments.surfaceWidth && region.offsetY + region.height == commandLineArguments.surfaceHeight) {
+                    if (bAdaptive)
+                        std::printf("Frame %u: %.2f Samples Per Pixel On Average\n", frameSlot.frameIndex,
+                            static_cast<double>(frameSampleCount) / (static_cast<double>(commandLineArguments.surfaceWidth) * commandLineArguments.surfaceHeight));
+                    frameSampleCount = 0u;
+                }
+
+                StartEncode(slot);
+                framesInReadback.pop_front();
+            }
+        };
+
+        // Records The Copy Of A Tile's Rows From The Accumulation (Or Resolved) Buffer To The Staging Buffer
+        auto RecordTileReadback = [&](const vk::CommandBuffer& commandBuffer, const FrameResources& frame, const FrameRegion& region, const PassConstants& tile) {
+            const vk::Buffer     sourceBuffer = bGpuResolve ? frame.resolvedBuffer.GetBuffer() : frame.accumulationBuffer.GetBuffer();
+            const vk::DeviceSize pixelStride = bGpuResolve ? resolvedStride : accumulationStride;
+
+            timings.readbackBytes += static_cast<std::uint64_t>(tile.tileExtentX) * tile.tileExtentY * (pixelStride + (commandLineArguments.bAovs ? (2u * sizeof(Colorf32)) : 0u));
+
+            // The AOV Rows Are Twice As Wide As A Float Accumulation's & Land After The Accumulation
+            std::vector<vk::BufferCopy> rowCopies(tile.tileExtentY), aovRowCopies(commandLineArguments.bAovs ? tile.tileExtentY : 0u);
+            for (std::uint32_t row = 0u; row < tile.tileExtentY; row++) {
+                const vk::DeviceSize rowIndex = static_cast<vk::DeviceSize>(region.GetIndex(tile.tileOffsetX, tile.tileOffsetY + row));
+                rowCopies[row] = vk::BufferCopy(rowIndex * pixelStride, rowIndex * pixelStride, tile.tileExtentX * pixelStride);
+
+                if (commandLineArguments.bAovs)
+                    aovRowCopies[row] = vk::BufferCopy(2u * rowIndex * sizeof(Colorf32), aovStagingOffset + 2u * rowIndex * sizeof(Colorf32), 2u * tile.tileExtentX * sizeof(Colorf32));
+            }
+
+            commandBuffer.copyBuffer(sourceBuffer, frame.stagingBuffer.GetBuffer(), static_cast<std::uint32_t>(rowCopies.size()), rowCopies.data());
+            if (commandLineArguments.bAovs)
+                commandBuffer.copyBuffer(frame.aovBuffer.GetBuffer(), frame.stagingBuffer.GetBuffer(), static_cast<std::uint32_t>(aovRowCopies.size()), aovRowCopies.data());
+
+            const auto hostReadBarrier = vk::MemoryBarrier(vk::AccessFlagBits::eTransferWrite, vk::AccessFlagBits::eHostRead);
+            commandBuffer.pipelineBarrier(vk::PipelineStageFlagBits::eTransfer, vk::PipelineStageFlagBits::eHost, vk::DependencyFlags{}, 1u, &hostReadBarrier, 0u, nullptr, 0u, nullptr);
+        };
+
+        // Records resolve.glsl Over A Tile After Its Final Pass, Packing Its Pixels Into The Resolved Buffer That Is Read Back
+        auto RecordTileResolve = [&](const vk::CommandBuffer& commandBuffer, const GpuDevice& device, const PassConstants& passConstants) {
+            const auto resolveBarrier = vk::MemoryBarrier(vk::AccessFlagBits::eShaderWrite, vk::AccessFlagBits::eShaderRead);
+            commandBuffer.pipelineBarrier(vk::PipelineStageFlagBits::eComputeShader, vk::PipelineStageFlagBits::eComputeShader, vk::DependencyFlags{}, 1u, &resolveBarrier, 0u, nullptr, 0u, nullptr);
+
+            commandBuffer.bindPipeline(vk::PipelineBindPoint::eCompute, device.resolvePipeline);
+            commandBuffer.pushConstants(device.computePipelineLayout, vk::ShaderStageFlagBits::eCompute, 0u, sizeof(PassConstants), &passConstants);
+            commandBuffer.dispatch((passConstants.tileExtentX + device.workgroupSize - 1u) / device.workgroupSize,
+                (passConstants.tileExtentY + device.workgroupSize - 1u) / device.workgroupSize, 1);
+        };
+
+        // Records One Pass Over A Tile As Wavefront Stages: Generate, Then Extend/Shade/Compact Per Bounce, Then Accumulate
+        auto RecordWavefrontPass = [&](const vk::CommandBuffer& commandBuffer, const GpuDevice& device, const FrameResources& frame, PassConstants passConstants) {
+            // Every Stage Reads What The Previous One Wrote, Including The Queue Headers Consumed As Indirect Arguments
+            auto StageBarrier = [&commandBuffer]() {
+                const auto stages  = vk::PipelineStageFlagBits::eDrawIndirect | vk::PipelineStageFlagBits::eComputeShader | vk::PipelineStageFlagBits::eTransfer;
+                const auto barrier = vk::MemoryBarrier(vk::AccessFlagBits::eShaderWrite | vk::AccessFlagBits::eTransferWrite,
+                    vk::AccessFlagBits::eIndirectCommandRead | vk::AccessFlagBits::eShaderRead | vk::AccessFlagBits::eShaderWrite | vk::AccessFlagBits::eTransferWrite);
+                commandBuffer.pipelineBarrier(stages, stages, vk::DependencyFlags{}, 1u, &barrier, 0u, nullptr, 0u, nullptr);
+            };
+
+            auto PushConstants = [&]() {
+                commandBuffer.pushConstants(device.computePipelineLayout, vk::ShaderStageFlagBits::eCompute, 0u, sizeof(PassConstants), &passConstants);
+            };
+
+            const vk::Buffer    queueBuffer = device.wavefrontBuffers[2].GetBuffer();
+            const std::uint32_t pathCount   = passConstants.tileExtentX * passConstants.tileExtentY * passConstants.sampleCount;
+            const std::uint32_t groupCount  = (pathCount + WAVEFRONT_WORKGROUP_SIZE - 1u) / WAVEFRONT_WORKGROUP_SIZE;
+
+            // Adaptive Passes Only Generate The Paths Of The Tile's Listed Pixels, Counted On The GPU
+            const bool           bPixelList            = passConstants.pixelList != NO_PIXEL_LIST;
+            const vk::Buffer     pixelListHeaderBuffer = frame.pixelListHeaderBuffer.GetBuffer();
+            const vk::DeviceSize pixelListHeaderOffset = bPixelList ? (passConstants.pixelList * sizeof(PixelListHeader)) : 0u;
+
+            // Generate Fills Queue 0 Entirely, Compact Appends To An Emptied Queue
+            const WavefrontQueue emptyQueue = { 0u, 1u, 1u, 0u };
+            const std::array<WavefrontQueue, 2u> initialQueues = { WavefrontQueue{ groupCount, 1u, 1u, pathCount }, emptyQueue };
+
+            StageBarrier(); // The Previous Submit May Still Use The Queues
+            if (bPixelList) {
+                const auto queueCopy = vk::BufferCopy(pixelListHeaderOffset + offsetof(PixelListHeader, pathGroupCountX), 0u, sizeof(WavefrontQueue));
+                commandBuffer.copyBuffer(pixelListHeaderBuffer, queueBuffer, 1u, &queueCopy);
+                commandBuffer.updateBuffer(queueBuffer, sizeof(WavefrontQueue), sizeof(WavefrontQueue), &emptyQueue);
+            } else {
+                commandBuffer.updateBuffer(queueBuffer, 0u, sizeof(initialQueues), initialQueues.data());
+            }
+            StageBarrier();
+
+            passConstants.bounceIndex = 0u;
+            PushConstants();
+            commandBuffer.bindPipeline(vk::PipelineBindPoint::eCompute, device.wavefrontPipelines[eWavefrontStageGenerate]);
+            if (bPixelList)
+                commandBuffer.dispatchIndirect(pixelListHeaderBuffer, pixelListHeaderOffset + offsetof(PixelListHeader, pathGroupCountX));
+            else
+                commandBuffer.dispatch(groupCount, 1u, 1u);
+
+            // Bounces Whose Queue Is Empty Still Get Recorded, But Dispatch Zero Workgroups
+            for (std::uint32_t bounceIndex = 0u; bounceIndex < commandLineArguments.maxBounces; bounceIndex++) {
+                const vk::DeviceSize inputQueueOffset = (bounceIndex % 2u) * sizeof(WavefrontQueue);
+
+                passConstants.bounceIndex = bounceIndex;
+                PushConstants();
+
+                StageBarrier();
+                if (bounceIndex > 0u) { // Empty The Previous Bounce's Input, Which Becomes This Bounce's Output
+                    commandBuffer.updateBuffer(queueBuffer, ((bounceIndex + 1u) % 2u) * sizeof(WavefrontQueue), sizeof(WavefrontQueue), &emptyQueue);
+                    StageBarrier();
+                }
+
+                commandBuffer.bindPipeline(vk::PipelineBindPoint::eCompute, device.wavefrontPipelines[eWavefrontStageExtend]);
+                commandBuffer.dispatchIndirect(queueBuffer, inputQueueOffset);
+                StageBarrier();
+
+                commandBuffer.bindPipeline(vk::PipelineBindPoint::eCompute, device.wavefrontPipelines[eWavefrontStageShade]);
+                commandBuffer.dispatchIndirect(queueBuffer, inputQueueOffset);
+
+                // Shade Terminates Every Path On The Last Bounce
+                if (bounceIndex + 1u < commandLineArguments.maxBounces) {
+                    StageBarrier();
+                    commandBuffer.bindPipeline(vk::PipelineBindPoint::eCompute, device.wavefrontPipelines[eWavefrontStageCompact]);
+                    commandBuffer.dispatchIndirect(queueBuffer, inputQueueOffset);
+                }
+            }
+
+            StageBarrier();
+            commandBuffer.bindPipeline(vk::PipelineBindPoint::eCompute, device.wavefrontPipelines[eWavefrontStageAccumulate]);
+            if (bPixelList)
+                commandBuffer.dispatchIndirect(pixelListHeaderBuffer, pixelListHeaderOffset);
+            else
+                commandBuffer.dispatch((passConstants.tileExtentX + device.workgroupSize - 1u) / device.workgroupSize,
+                    (passConstants.tileExtentY + device.workgroupSize - 1u) / device.workgroupSize, 1);
+        };
+
+        // Records The Compaction Of A Tile's Unconverged Pixels Into Its List, Which The Pass' Dispatches Then Read Indirectly
+        auto RecordPixelListCompaction = [&](const vk::CommandBuffer& commandBuffer, const GpuDevice& device, const FrameResources& frame, const PassConstants& passConstants) {
+            // The Previous Pass Over The Tile Read The Header As Indirect Arguments
+            const auto resetBarrier = vk::MemoryBarrier(vk::AccessFlagBits::eShaderWrite, vk::AccessFlagBits::eTransferWrite);
+            commandBuffer.pipelineBarrier(vk::PipelineStageFlagBits::eDrawIndirect | vk::PipelineStageFlagBits::eComputeShader, vk::PipelineStageFlagBits::eTransfer,
+                vk::DependencyFlags{}, 1u, &resetBarrier, 0u, nullptr, 0u, nullptr);
+
+            const PixelListHeader emptyHeader = { 0u, 1u, 1u, 0u, 0u, 1u, 1u, 0u };
+            commandBuffer.updateBuffer(frame.pixelListHeaderBuffer.GetBuffer(), passConstants.pixelList * sizeof(PixelListHeader), sizeof(PixelListHeader), &emptyHeader);
+
+            const auto compactBarrier = vk::MemoryBarrier(vk::AccessFlagBits::eTransferWrite, vk::AccessFlagBits::eShaderRead | vk::AccessFlagBits::eShaderWrite);
+            commandBuffer.pipelineBarrier(vk::PipelineStageFlagBits::eTransfer, vk::PipelineStageFlagBits::eComputeShader, vk::DependencyFlags{}, 1u, &compactBarrier, 0u, nullptr, 0u, nullptr);
+
+            commandBuffer.bindPipeline(vk::PipelineBindPoint::eCompute, device.adaptivePipeline);
+            commandBuffer.pushConstants(device.computePipelineLayout, vk::ShaderStageFlagBits::eCompute, 0u, sizeof(PassConstants), &passConstants);
+            commandBuffer.dispatch((passConstants.tileExtentX + device.workgroupSize - 1u) / device.workgroupSize,
+                (passConstants.tileExtentY + device.workgroupSize - 1u) / device.workgroupSize, 1);
+
+            const auto listBarrier = vk::MemoryBarrier(vk::AccessFlagBits::eShaderWrite, vk::AccessFlagBits::eIndirectCommandRead | vk::AccessFlagBits::eShaderRead | vk::AccessFlagBits::eTransferRead);
+            commandBuffer.pipelineBarrier(vk::PipelineStageFlagBits::eComputeShader, vk::PipelineStageFlagBits::eDrawIndirect | vk::PipelineStageFlagBits::eComputeShader | vk::PipelineStageFlagBits::eTransfer,
+                vk::DependencyFlags{}, 1u, &listBarrier, 0u, nullptr, 0u, nullptr);
+        };
+
+        // Accumulates The GPU Time Of A Retired Submit's Dispatch
+        auto CollectTimestamps = [&](GpuDevice& device, const std::uint32_t submitSlot) {
+            if (!device.slotHasTimestamps[submitSlot])
+                return;
+
+            std::uint64_t timestamps[2u] = { 0u, 0u };
+            if (device.logicalDevice.getQueryPoolResults(device.timestampQueryPool, 2u * submitSlot, 2u, sizeof(timestamps), timestamps, sizeof(std::uint64_t), vk::QueryResultFlagBits::e64) == vk::Result::eSuccess) {
+                const std::uint64_t mask  = (device.timestampValidBits >= 64u) ? UINT64_MAX : ((1ull << device.timestampValidBits) - 1u);
+                const std::uint64_t ticks = (timestamps[1] - timestamps[0]) & mask;
+                profiler.AddGpuDispatch(ticks * static_cast<double>(device.properties.limits.timestampPeriod) / 1e6);
+            }
+
+            device.slotHasTimestamps[submitSlot] = false;
+        };
+
+        // Copies The Tiles A Device Traced During The Frame To Its Staging Buffer, Only Those Not Read Back Yet When 'bLeftoversOnly'
+        auto SubmitTracedTilesReadback = [&](GpuDevice& device, FrameResources& frame, const FrameRegion& region, const bool bLeftoversOnly, const vk::Semaphore* pSignalSemaphore) {
+            const std::uint32_t submitSlot = device.submitIndex % submitSlotCount;
+
+            device.logicalDevice.waitForFences(1u, &device.fences[submitSlot], VK_TRUE, UINT64_MAX);
+            device.logicalDevice.resetFences(1u, &device.fences[submitSlot]);
+            CollectTimestamps(device, submitSlot);
+
+            const vk::CommandBuffer& commandBuffer = device.commandBuffers[submitSlot];
+            commandBuffer.begin(vk::CommandBufferBeginInfo(vk::CommandBufferUsageFlagBits::eOneTimeSubmit, nullptr));
+
+            const auto readbackBarrier = vk::MemoryBarrier(vk::AccessFlagBits::eShaderWrite, vk::AccessFlagBits::eTransferRead);
+            commandBuffer.pipelineBarrier(vk::PipelineStageFlagBits::eComputeShader, vk::PipelineStageFlagBits::eTransfer, vk::DependencyFlags{}, 1u, &readbackBarrier, 0u, nullptr, 0u, nullptr);
+
+            for (std::uint32_t tile = 0u; tile < tileCount; tile++) {
+                if (!frame.tilesTraced[tile] || (bLeftoversOnly && frame.tilesReadBack[tile]))
+                    continue;
+
+                RecordTileReadback(commandBuffer, frame, region, GetTile(region, tile));
+            }
+
+            commandBuffer.end();
+
+            const auto submitInfo = vk::SubmitInfo(
+                0, nullptr, nullptr,
+                1u, &commandBuffer,
+                pSignalSemaphore ? 1u : 0u, pSignalSemaphore
+            );
+
+            device.computeQueue.submit(1u, &submitInfo, device.fences[submitSlot]);
+            device.submitIndex++;
+        };
+
+        // Copies Every Device's Partial Accumulation Back Mid-Frame & Writes The Checkpoint, Stalling The Devices Once Per Interval
+        auto WriteCheckpoint = [&](const std::uint32_t slot, const std::uint32_t samplesPerPixel) {
+            const ProfileScope profileScope(profiler, "Checkpoint");
+
+            for (const std::unique_ptr<GpuDevice>& pDevice : devices)
+                if (pDevice->frameResources[slot].bCleared)
+                    SubmitTracedTilesReadback(*pDevice, pDevice->frameResources[slot], frameSlots[slot].region, false, nullptr);
+
+            for (const std::unique_ptr<GpuDevice>& pDevice : devices)
+                pDevice->logicalDevice.waitForFences(static_cast<std::uint32_t>(pDevice->fences.size()), pDevice->fences.data(), VK_TRUE, UINT64_MAX);
+
+            std::vector<Colorf32>& merged = frameSlots[slot].merged;
+            MergeReadbacks(slot, merged);
+            checkpointer.AddResumed(merged.data(), merged.data() + pixelCount);
+            checkpointer.Write(merged.data(), merged.data() + pixelCount, samplesPerPixel);
+        };
+
+        // Hands Out Tiles On Demand: A Tile Goes To The First Device Whose Next Submit Slot Has Retired, So Faster Devices Take More Tiles
+        // A Tile Pinned To A Device Waits For That Device
+        auto AcquireDevice = [&](const std::optional<std::uint32_t> pinnedDevice) {
+            constexpr std::uint64_t POLL_NANOSECONDS = 50000u; // How Long Each Device Is Waited For In Turn While None Is Free
+
+            const auto waitStart = std::chrono::steady_clock::now();
+
+            std::uint32_t acquiredDevice = pinnedDevice.value_or(0u);
+            if (pinnedDevice || devices.size() == 1u) {
+                const GpuDevice& device = *devices[acquiredDevice];
+                device.logicalDevice.waitForFences(1u, &device.fences[device.submitIndex % submitSlotCount], VK_TRUE, UINT64_MAX);
+            } else {
+                for (bool bAcquired = false; !bAcquired; ) {
+                    for (std::uint32_t d = 0u; d < devices.size() && !bAcquired; d++) {
+                        const GpuDevice& device = *devices[d];
+                        if (device.logicalDevice.waitForFences(1u, &device.fences[device.submitIndex % submitSlotCount], VK_TRUE, POLL_NANOSECONDS) == vk::Result::eSuccess) {
+                            acquiredDevice = d;
+                            bAcquired      = true;
+                        }
+                    }
+                }
+            }
+
+            profiler.AddToTotal("Wait For Submit Slot", waitStart);
+
+            return acquiredDevice;
+        };
+
+        const ProfileScope renderProfileScope(profiler, "Render");
+        const auto batchStart = std::chrono::steady_clock::now();
+
+        // The Frame Being Rendered, Over Its Regions
+        size_t        frameSpan = 0u;
+        auto          frameStart = batchStart;
+        std::uint32_t frameMinSamplesPerPixel = 0u, frameMaxSamplesPerPixel = 0u;
+
+        for (std::uint64_t job = 0u; job < jobCount; job++) {
+            const std::uint32_t frameIndex  = static_cast<std::uint32_t>(job / regionCount);
+            const std::uint64_t regionIndex = job % regionCount;
+            const std::uint32_t slot        = static_cast<std::uint32_t>(job % frameSlotCount);
+            FrameSlot&          frameSlot   = frameSlots[slot];
+
+            // The Slot's Previous Job Must Be Read Back & Encoded Before Its Buffers Are Reused
+            RetireReadbacks(static_cast<std::int64_t>(job) - frameSlotCount);
+            if (frameSlot.encodeJob.valid()) {
+                const auto waitStart = std::chrono::steady_clock::now();
+                frameSlot.encodeJob.get();
+                profiler.AddToTotal("Wait For Encode", waitStart);
+
+                timings.encodeSeconds += frameSlot.encodeSeconds;
+                frameSlot.encodeJob    = std::shared_future<void>();
+            }
+
+            if (regionIndex == 0u) {
+                frameSpan  = profiler.BeginSpan("Frame " + std::to_string(frameIndex));
+                frameStart = std::chrono::steady_clock::now();
+                frameMinSamplesPerPixel = UINT32_MAX;
+                frameMaxSamplesPerPixel = 0u;
+            }
+
+            const auto renderStart = std::chrono::steady_clock::now();
+            auto GetElapsedSeconds = [&renderStart]() {
+                return std::chrono::duration<float>(std::chrono::steady_clock::now() - renderStart).count();
+            };
+
+            // Out Of Core, The Frame's Tiles Are Its Regions In Row-Major Order (As The Frame Streamer Expects)
+            frameSlot.frameIndex = frameIndex;
+            frameSlot.region     = FrameRegion{ 0u, 0u, commandLineArguments.surfaceWidth, commandLineArguments.surfaceHeight };
+            if (bOutOfCore) {
+                frameSlot.region.offsetX = static_cast<std::uint32_t>(regionIndex % frameTileCountX) * tileSize;
+                frameSlot.region.offsetY = static_cast<std::uint32_t>(regionIndex / frameTileCountX) * tileSize;
+                frameSlot.region.width   = std::min(tileSize, commandLineArguments.surfaceWidth  - frameSlot.region.offsetX);
+                frameSlot.region.height  = std::min(tileSize, commandLineArguments.surfaceHeight - frameSlot.region.offsetY);
+            }
+
+            const FrameRegion& region = frameSlot.region;
+
+            // The Regions Split A Time Budget Evenly
+            const float regionBudget = commandLineArguments.timeBudget / static_cast<float>(regionCount);
+
+            frameSlot.sampleCount       = 0u;
+            frameSlot.listedSampleCount = 0u;
+            frameSlot.tileDevices.assign(tileCount, 0u);
+
+            for (const std::unique_ptr<GpuDevice>& pDevice : devices) {
+                FrameResources& frame = pDevice->frameResources[slot];
+                frame.bCleared = false;
+                frame.tilesTraced.assign(tileCount, false);
+                frame.tilesReadBack.assign(tileCount, false);
+            }
+
+            std::uint32_t passCount = 0u, samplesPerPixel = 0u;
+            for (bool bFinalPass = false; !bFinalPass; ) {
+                if (passCount > 0u && checkpointer.IsDue())
+                    WriteCheckpoint(slot, samplesPerPixel);
+
+                const std::uint32_t sampleOffset = samplesPerPixel;
+                const std::uint32_t sampleCount  = std::min(commandLineArguments.samplesPerPass, checkpointer.GetSampleCount() - sampleOffset);
+
+                // Once Every Pixel Has Its Minimum Samples, Passes Only Trace The Pixels That Haven't Converged
+                // They Wait For The Previous Pass, Whose Lists Tell How Many Pixels Were Left
+                const bool bAdaptivePass = bAdaptive && sampleOffset >= commandLineArguments.adaptiveMinSamples;
+                bool       bConverged    = false;
+                if (bAdaptivePass) {
+                    const auto waitStart = std::chrono::steady_clock::now();
+                    for (const std::unique_ptr<GpuDevice>& pDevice : devices)
+                        pDevice->logicalDevice.waitForFences(static_cast<std::uint32_t>(pDevice->fences.size()), pDevice->fences.data(), VK_TRUE, UINT64_MAX);
+                    profiler.AddToTotal("Wait For Previous Pass", waitStart);
+
+                    if (frameSlot.listedSampleCount > 0u) {
+                        const std::uint64_t listedPixelCount = CountListedPixels(slot);
+                        frameSlot.sampleCount += listedPixelCount * frameSlot.listedSampleCount;
+                        bConverged = listedPixelCount == 0u;
+                    }
+
+                    frameSlot.listedSampleCount = sampleCount;
+                } else {
+                    frameSlot.sampleCount += region.GetPixelCount() * sampleCount;
+                }
+
+                // The Last Pass Is Decided Up Front So That Its Tiles Can Be Read Back As They Complete
+                // Under A Time Budget, It Is The One Expected To Cross The Budget
+                // Once The Previous Pass Had No Pixel Left, This One Only Reads The Frame Back
+                const float elapsedSeconds = GetElapsedSeconds();
+                const float passSeconds    = (passCount > 0u) ? (elapsedSeconds / passCount) : 0.f;
+
+                bFinalPass = bConverged || (sampleOffset + sampleCount >= checkpointer.GetSampleCount()) ||
+                    (commandLineArguments.timeBudget > 0.f && elapsedSeconds + passSeconds >= regionBudget);
+
+                for (std::uint32_t tileY = 0u; tileY < tileCountY; tileY++) {
+                    for (std::uint32_t tileX = 0u; tileX < tileCountX; tileX++) {
+                        const std::uint32_t tile = tileY * tileCountX + tileX;
+
+                        // With --adaptive, A Tile Stays On The Device That Traced Its First Pass, Which Holds Its Moments
+                        const std::uint32_t deviceIndex = AcquireDevice((bAdaptive && passCount > 0u) ? std::optional<std::uint32_t>(frameSlot.tileDevices[tile]) : std::nullopt);
+                        GpuDevice&          device      = *devices[deviceIndex];
+                        FrameResources&     frame       = device.frameResources[slot];
+                        const vk::Device&   logicalDevice = device.logicalDevice;
+
+                        const std::uint32_t submitSlot = device.submitIndex % submitSlotCount;
+                        frameSlot.tileDevices[tile] = deviceIndex;
+
+                        // The Slot's Previous Submits Have Retired, Its Command Buffers Can Be Re-Recorded
+                        logicalDevice.resetFences(1u, &device.fences[submitSlot]);
+                        CollectTimestamps(device, submitSlot);
+
+                        PassConstants passConstants = GetTile(region, tile);
+                        passConstants.sampleOffset = checkpointer.GetFirstSample() + sampleOffset;
+                        passConstants.sampleCount  = sampleCount;
+                        passConstants.frameIndex   = frameIndex;
+                        passConstants.bounceIndex  = 0u;
+                        passConstants.pixelList       = bAdaptivePass ? tile : NO_PIXEL_LIST;
+                        passConstants.pixelListOffset = (passConstants.tileOffsetY - region.offsetY) * region.width + (passConstants.tileOffsetX - region.offsetX) * passConstants.tileExtentY;
+                        passConstants.padding[0]      = passConstants.padding[1] = 0u;
+                        for (size_t c = 0u; c < 3u; c++) {
+                            passConstants.cameraPosition[c] = cameras[frameIndex].position[c];
+                            passConstants.cameraTarget[c]   = cameras[frameIndex].target[c];
+                        }
+                        passConstants.cameraPosition[3] = passConstants.cameraTarget[3] = 0.f;
+
+                        const vk::CommandBuffer& commandBuffer = device.commandBuffers[submitSlot];
+                        commandBuffer.begin(vk::CommandBufferBeginInfo(vk::CommandBufferUsageFlagBits::eOneTimeSubmit, nullptr));
+
+                        if (!frame.bCleared) {
+                            // Clear The Accumulation Buffer (& The Moments & AOVs) Before The Device's First Tile Of The Frame
+                            commandBuffer.fillBuffer(frame.accumulationBuffer.GetBuffer(), 0u, VK_WHOLE_SIZE, 0u);
+                            if (bAdaptive)
+                                commandBuffer.fillBuffer(frame.momentsBuffer.GetBuffer(), 0u, VK_WHOLE_SIZE, 0u);
+                            if (commandLineArguments.bAovs)
+                                commandBuffer.fillBuffer(frame.aovBuffer.GetBuffer(), 0u, VK_WHOLE_SIZE, 0u);
+
+                            const auto clearBarrier = vk::MemoryBarrier(vk::AccessFlagBits::eTransferWrite, vk::AccessFlagBits::eShaderRead | vk::AccessFlagBits::eShaderWrite);
+                            commandBuffer.pipelineBarrier(vk::PipelineStageFlagBits::eTransfer, vk::PipelineStageFlagBits::eComputeShader, vk::DependencyFlags{}, 1u, &clearBarrier, 0u, nullptr, 0u, nullptr);
+
+                            frame.bCleared = true;
+                        } else {
+                            // Order This Pass' Read-Modify-Write After The Previously Submitted Ones
+                            const auto accumulationBarrier = vk::MemoryBarrier(vk::AccessFlagBits::eShaderWrite, vk::AccessFlagBits::eShaderRead | vk::AccessFlagBits::eShaderWrite);
+                            commandBuffer.pipelineBarrier(vk::PipelineStageFlagBits::eComputeShader, vk::PipelineStageFlagBits::eComputeShader, vk::DependencyFlags{}, 1u, &accumulationBarrier, 0u, nullptr, 0u, nullptr);
+                        }
+
+                        const std::array<vk::DescriptorSet, 2u> descriptorSets = { frame.descriptorSet, device.wavefrontDescriptorSet };
+                        commandBuffer.bindDescriptorSets(vk::PipelineBindPoint::eCompute, device.computePipelineLayout, 0, bWavefront ? 2u : 1u, descriptorSets.data(), 0, nullptr);
+                        if (device.bGpuTimestamps) {
+                            commandBuffer.resetQueryPool(device.timestampQueryPool, 2u * submitSlot, 2u);
+                            commandBuffer.writeTimestamp(vk::PipelineStageFlagBits::eTopOfPipe, device.timestampQueryPool, 2u * submitSlot);
+                        }
+
+                        if (bAdaptivePass)
+                            RecordPixelListCompaction(commandBuffer, device, frame, passConstants);
+
+                        if (bWavefront) {
+                            RecordWavefrontPass(commandBuffer, device, frame, passConstants);
+                        } else {
+                            commandBuffer.bindPipeline(vk::PipelineBindPoint::eCompute, device.computePipeline);
+                            commandBuffer.pushConstants(device.computePipelineLayout, vk::ShaderStageFlagBits::eCompute, 0u, sizeof(PassConstants), &passConstants);
+                            if (bAdaptivePass)
+                                commandBuffer.dispatchIndirect(frame.pixelListHeaderBuffer.GetBuffer(), passConstants.pixelList * sizeof(PixelListHeader));
+                            else
+                                commandBuffer.dispatch((passConstants.tileExtentX + device.workgroupSize - 1u) / device.workgroupSize,
+                                    (passConstants.tileExtentY + device.workgroupSize - 1u) / device.workgroupSize, 1);
+                        }
+
+                        if (device.bGpuTimestamps) {
+                            commandBuffer.writeTimestamp(vk::PipelineStageFlagBits::eBottomOfPipe, device.timestampQueryPool, 2u * submitSlot + 1u);
+                            device.slotHasTimestamps[submitSlot] = true;
+                        }
+
+                        if (profiler.IsEnabled() || bAdaptivePass) {
+                            // Makes The Ray Counters & Pixel List Headers Visible To The Host Once The Submit Retires
+                            const auto rayStatsBarrier = vk::MemoryBarrier(vk::AccessFlagBits::eShaderWrite, vk::AccessFlagBits::eHostRead);
+                            commandBuffer.pipelineBarrier(vk::PipelineStageFlagBits::eComputeShader, vk::PipelineStageFlagBits::eHost, vk::DependencyFlags{}, 1u, &rayStatsBarrier, 0u, nullptr, 0u, nullptr);
+                        }
+
+                        if (bFinalPass && bGpuResolve)
+                            RecordTileResolve(commandBuffer, device, passConstants);
+
+                        if (bFinalPass && !device.bDedicatedTransferQueue) {
+                            const auto readbackBarrier = vk::MemoryBarrier(vk::AccessFlagBits::eShaderWrite, vk::AccessFlagBits::eTransferRead);
+                            commandBuffer.pipelineBarrier(vk::PipelineStageFlagBits::eComputeShader, vk::PipelineStageFlagBits::eTransfer, vk::DependencyFlags{}, 1u, &readbackBarrier, 0u, nullptr, 0u, nullptr);
+
+                            RecordTileReadback(commandBuffer, frame, region, passConstants);
+                        }
+
+                        commandBuffer.end();
+
+                        const bool bTransferThisTile = bFinalPass && device.bDedicatedTransferQueue;
+
+                        const auto submitInfo = vk::SubmitInfo(
+                            0, nullptr, nullptr,
+                            1u, &commandBuffer,
+                            bTransferThisTile ? 1u : 0u, bTransferThisTile ? &device.tileCompleteSemaphores[submitSlot] : nullptr
+                        );
+
+                        device.computeQueue.submit(1u, &submitInfo, device.fences[submitSlot]);
+
+                        if (bTransferThisTile) {
+                            logicalDevice.waitForFences(1u, &device.transferFences[submitSlot], VK_TRUE, UINT64_MAX);
+                            logicalDevice.resetFences(1u, &device.transferFences[submitSlot]);
+
+                            const vk::CommandBuffer& transferCommandBuffer = device.transferCommandBuffers[submitSlot];
+                            transferCommandBuffer.begin(vk::CommandBufferBeginInfo(vk::CommandBufferUsageFlagBits::eOneTimeSubmit, nullptr));
+                            RecordTileReadback(transferCommandBuffer, frame, region, passConstants);
+                            transferCommandBuffer.end();
+
+                            const vk::PipelineStageFlags waitStage = vk::PipelineStageFlagBits::eTransfer;
+                            const auto transferSubmitInfo = vk::SubmitInfo(
+                                1u, &device.tileCompleteSemaphores[submitSlot], &waitStage,
+                                1u, &transferCommandBuffer,
+                                0u, nullptr
+                            );
+
+                            device.transferQueue.submit(1u, &transferSubmitInfo, device.transferFences[submitSlot]);
+                        }
+
+                        frame.tilesTraced[tile] = true;
+                        if (bFinalPass)
+                            frame.tilesReadBack[tile] = true;
+
+                        device.submitIndex++;
+                        device.tileCount++;
+
+                        // Previous Frames Start Encoding As Soon As Their Readback Lands
+                        RetireReadbacks(-1);
+                    }
+                }
+
+                passCount++;
+                samplesPerPixel += sampleCount;
+            }
+
+            frameSlot.samplesPerPixel = samplesPerPixel;
+
+            for (const std::unique_ptr<GpuDevice>& pDevice : devices) {
+                GpuDevice&        device        = *pDevice;
+                FrameResources&   frame         = device.frameResources[slot];
+                const vk::Device& logicalDevice = device.logicalDevice;
+
+                // With Several Devices, A Device Also Holds Samples Of Tiles Another One Took In The Final Pass: Copy Those Too
+                // The Readback Fence Below Is Signaled From The Transfer Queue When There Is One
+                bool bLeftoverCopies = false;
+                for (std::uint32_t tile = 0u; tile < tileCount; tile++)
+                    bLeftoverCopies = bLeftoverCopies || (frame.tilesTraced[tile] && !frame.tilesReadBack[tile]);
+
+                if (bLeftoverCopies)
+                    SubmitTracedTilesReadback(device, frame, region, true, device.bDedicatedTransferQueue ? &frame.readbackSemaphore : nullptr);
+
+                // An Empty Submit Signals Once Everything Previously Submitted To The Queue (The Final Copies) Has Completed
+                const vk::PipelineStageFlags waitStage = vk::PipelineStageFlagBits::eTransfer;
+                const bool bWaitForLeftovers = bLeftoverCopies && device.bDedicatedTransferQueue;
+                const auto readbackSubmitInfo = vk::SubmitInfo(
+                    bWaitForLeftovers ? 1u : 0u, bWaitForLeftovers ? &frame.readbackSemaphore : nullptr, bWaitForLeftovers ? &waitStage : nullptr,
+                    0u, nullptr,
+                    0u, nullptr
+                );
+
+                logicalDevice.resetFences(1u, &frame.readbackFence);
+                (device.bDedicatedTransferQueue ? device.transferQueue : device.computeQueue).submit(1u, &readbackSubmitInfo, frame.readbackFence);
+            }
+
+            framesInReadback.emplace_back(job, slot);
+
+            frameMinSamplesPerPixel = std::min(frameMinSamplesPerPixel, samplesPerPixel);
+            frameMaxSamplesPerPixel = std::max(frameMaxSamplesPerPixel, samplesPerPixel);
+
+            if (regionIndex + 1u < regionCount)
+                continue;
+
+            if (bOutOfCore)
+                std::printf("Frame %u: %s%u Samples Per Pixel Over %llu Tiles Rendered Out Of Core (%.3fs)\n", frameIndex,
+                    (bAdaptive || frameMinSamplesPerPixel != frameMaxSamplesPerPixel) ? "Up To " : "", frameMaxSamplesPerPixel,
+                    static_cast<unsigned long long>(regionCount), std::chrono::duration<float>(std::chrono::steady_clock::now() - frameStart).count());
+            else
+                std::printf("Frame %u: %s%u Samples Per Pixel In %u Passes (%.3fs)\n", frameIndex, bAdaptive ? "Up To " : "", samplesPerPixel, passCount, GetElapsedSeconds());
+
+            profiler.EndSpan(frameSpan);
+        }
+
+        // Drain The Pipeline
+        RetireReadbacks(static_cast<std::int64_t>(jobCount));
+        for (FrameSlot& frameSlot : frameSlots) {
+            if (frameSlot.encodeJob.valid()) {
+                frameSlot.encodeJob.get();
+                timings.encodeSeconds += frameSlot.encodeSeconds;
+            }
+        }
+
+        for (const std::unique_ptr<GpuDevice>& pDevice : devices) {
+            GpuDevice& device = *pDevice;
+
+            device.logicalDevice.waitForFences(static_cast<std::uint32_t>(device.fences.size()), device.fences.data(), VK_TRUE, UINT64_MAX);
+            if (device.bDedicatedTransferQueue)
+                device.logicalDevice.waitForFences(static_cast<std::uint32_t>(device.transferFences.size()), device.transferFences.data(), VK_TRUE, UINT64_MAX);
+
+            for (std::uint32_t submitSlot = 0u; submitSlot < submitSlotCount; submitSlot++)
+                CollectTimestamps(device, submitSlot);
+        }
+
+        profileCounters.renderSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - batchStart).count();
+
+        if (frameCount > 1u)
+            std::printf("Rendered %u Frames In %.3fs\n", frameCount, std::chrono::duration<float>(std::chrono::steady_clock::now() - batchStart).count());
+
+        // How The Scheduler Spread The Work
+        if (devices.size() > 1u) {
+            std::uint64_t totalTileCount = 0u;
+            for (const std::unique_ptr<GpuDevice>& pDevice : devices)
+                totalTileCount += pDevice->tileCount;
+
+            for (const std::unique_ptr<GpuDevice>& pDevice : devices)
+                std::printf("Device %u (%s): %llu Tiles (%.1f%%)\n", pDevice->physicalDeviceIndex, pDevice->name.c_str(),
+                    static_cast<unsigned long long>(pDevice->tileCount), 100.0 * pDevice->tileCount / std::max<std::uint64_t>(totalTileCount, 1u));
+        }
+    }
+
+    timings.renderSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - prepareStart).count() - timings.prepareSeconds;
+
+    return timings;
+}
+
+// Destroys Every Device & The Instance, Once The Jobs Have Drained Their Submits
+void DestroyGpuContext(GpuContext& context, Profiler& profiler) {
+    const ProfileScope profileScope(profiler, "Destroy");
+
+    for (const std::unique_ptr<GpuDevice>& pDevice : context.devices) {
+        GpuDevice&        device        = *pDevice;
+        const vk::Device& logicalDevice = device.logicalDevice;
+
+        for (const vk::Fence& fence : device.fences)
+            logicalDevice.destroyFence(fence);
+        for (const vk::Fence& fence : device.transferFences)
+            logicalDevice.destroyFence(fence);
+        for (const vk::Semaphore& semaphore : device.tileCompleteSemaphores)
+            logicalDevice.destroySemaphore(semaphore);
+        logicalDevice.freeCommandBuffers(device.commandPool, static_cast<std::uint32_t>(device.commandBuffers.size()), device.commandBuffers.data());
+        logicalDevice.destroyCommandPool(device.commandPool);
+        if (device.bDedicatedTransferQueue) {
+            logicalDevice.freeCommandBuffers(device.transferCommandPool, static_cast<std::uint32_t>(device.transferCommandBuffers.size()), device.transferCommandBuffers.data());
+            logicalDevice.destroyCommandPool(device.transferCommandPool);
+        }
+        if (device.bGpuTimestamps)
+            logicalDevice.destroyQueryPool(device.timestampQueryPool);
+        for (const vk::ShaderModule& shaderModule : device.shaderModules)
+            logicalDevice.destroyShaderModule(shaderModule);
+        logicalDevice.destroyShaderModule(device.resolveShaderModule); // A Null Handle Unless A Job Resolved On The GPU
+        for (const auto& [specialization, pipelines] : device.specializedPipelines)
+            for (const vk::Pipeline& pipeline : pipelines)
+                logicalDevice.destroyPipeline(pipeline);
+        logicalDevice.destroyPipelineCache(device.pipelineCache);
+        logicalDevice.destroyPipelineLayout(device.computePipelineLayout);
+        logicalDevice.resetDescriptorPool(device.descriptorPool);
+        logicalDevice.destroyDescriptorPool(device.descriptorPool);
+        logicalDevice.destroyDescriptorSetLayout(device.descriptorSetLayout);
+        logicalDevice.destroyDescriptorSetLayout(device.wavefrontDescriptorSetLayout); // A Null Handle Without --kernel wavefront
+        DestroyFrameResources(device);
+        device.rayStatsBuffer->UnAllocate();
+        device.rayStatsBuffer->Destroy();
+        if (device.sceneBuffer) {
+            device.sceneBuffer->UnAllocate();
+            device.sceneBuffer->Destroy();
+        }
+        for (VulkanBuffer& buffer : device.wavefrontBuffers) {
+            buffer.UnAllocate();
+            buffer.Destroy();
+        }
+        device.memoryArena->PrintUsageReport();
+        device.memoryArena->Destroy();
+        logicalDevice.destroy();
+    }
+
+    context.instance.destroy();
+}
+
+// ./PolarTracer bench readback -w <n> -h <n> [--spp <n>] [--frames <n>] [--scene <file>] ...
+// Renders The Same Frames With Each Accumulation Format & Resolve & Compares What Getting Them Off The GPU Costs: The Bytes Read
+// Back, The Host's Wait For Those Copies & The Encode Threads' Time Turning Them Into Images (PAMs, In A Temporary Directory)
+void RunReadbackBenchmark(const CommandLineArguments& commandLineArguments, const Scene& scene, const std::vector<Camera>& cameras, Profiler& profiler) {
+    // Every Mode Reads Back The Color Alone, Which Is All A GPU Resolve Keeps
+    CommandLineArguments benchmarkArguments = commandLineArguments;
+    benchmarkArguments.checkpointFilename.clear();
+    benchmarkArguments.bDenoise     = false;
+    benchmarkArguments.aovExports   = 0u;
+    benchmarkArguments.bAovs        = false;
+    benchmarkArguments.outputFormat = ImageFormat::ePAM;
+
+    const std::filesystem::path outputDirectory = std::filesystem::temp_directory_path() / "polar-bench-readback";
+    std::filesystem::create_directories(outputDirectory);
+    benchmarkArguments.outputPrefix = (outputDirectory / "frame").string();
+
+    std::optional<GpuContext> context;
+    try {
+        context.emplace(CreateGpuContext(benchmarkArguments, profiler));
+    }
+    catch (const NoCompatibleDeviceError& err) {
+        throw std::runtime_error(std::string("bench readback Needs A Vulkan Device: ") + err.what());
+    }
+
+    struct Mode {
+        const char*        pName;
+        AccumulationFormat accumulationFormat;
+        GpuResolve         resolve;
+    }; // Mode
+
+    const std::array<Mode, 5u> modes = { {
+        { "rgba32f / host",   AccumulationFormat::eRGBA32F, GpuResolve::eHost   },
+        { "rgba16f / host",   AccumulationFormat::eRGBA16F, GpuResolve::eHost   },
+        { "rgba32f / rgba8",  AccumulationFormat::eRGBA32F, GpuResolve::eRGBA8  },
+        { "rgba16f / rgba8",  AccumulationFormat::eRGBA16F, GpuResolve::eRGBA8  },
+        { "rgba16f / rgb9e5", AccumulationFormat::eRGBA16F, GpuResolve::eRGB9E5 }
+    } };
+
+    std::printf("Readback Benchmark: %ux%u, %u Frames Of %u Samples Per Pixel\n\n", benchmarkArguments.surfaceWidth, benchmarkArguments.surfaceHeight,
+        benchmarkArguments.frameCount, benchmarkArguments.samplesPerPixel);
+
+    std::vector<std::string> rows;
+    for (const Mode& mode : modes) {
+        CommandLineArguments job = benchmarkArguments;
+        job.accumulationFormat = mode.accumulationFormat;
+        job.gpuResolve         = mode.resolve;
+
+        Checkpointer       checkpointer(job, scene, cameras.front()); // Disabled
+        Profiler::Counters profileCounters;
+
+        // The First Job Also Uploads The Scene, Which Its Timings Leave Out Like The Pipelines
+        const JobTimings timings = RenderGpuJob(*context, job, scene, &mode == &modes.front(), cameras, checkpointer, profiler, profileCounters);
+
+        const double frameCount = static_cast<double>(job.frameCount);
+
+        char row[160] = { 0 };
+        std::snprintf(row, sizeof(row), "%-18s  %12.2f  %14.3f  %12.3f  %12.3f", mode.pName, timings.readbackBytes / frameCount / (1024.0 * 1024.0),
+            timings.readbackWaitSeconds * 1e3 / frameCount, timings.encodeSeconds * 1e3 / frameCount, timings.renderSeconds * 1e3 / frameCount);
+        rows.push_back(row);
+    }
+
+    DestroyGpuContext(*context, profiler);
+    std::filesystem::remove_all(outputDirectory);
+
+    // Printed Once The Renders' Own Logging Is Done
+    std::printf("\n%-18s  %12s  %14s  %12s  %12s\n", "Accum / Resolve", "MiB/Frame", "Wait ms/Frame", "Encode ms", "Frame ms");
+    for (const std::string& row : rows)
+        std::printf("%s\n", row.c_str());
+}
+
+// ./PolarTracer serve's Jobs & Responses, One JSON Object Per Line. Over stdin, stdout Only Carries The Responses (The Log Moves
+// To stderr). Over A Unix Domain Socket, Clients Connect One At A Time & Each Gets The Responses To Its Own Jobs
+class JobChannel {
+private:
+    const std::string m_socketPath;
+    FILE*             m_pResponses   = nullptr; // The Original stdout, When Reading stdin
+    int               m_listenSocket = -1;
+    int               m_clientSocket = -1;
+    std::string       m_received;               // What The Client Sent Past Its Last Complete Line
+
+public:
+    // Reads stdin When 'socketPath' Is Empty
+    explicit JobChannel(const std::string& socketPath)
+        : m_socketPath(socketPath)
+    {
+        if (socketPath.empty()) {
+            std::fflush(stdout);
+
+#ifdef _WIN32
+            this->m_pResponses = _fdopen(_dup(_fileno(stdout)), "w");
+            _dup2(_fileno(stderr), _fileno(stdout));
+#else
+            this->m_pResponses = fdopen(dup(fileno(stdout)), "w");
+            dup2(fileno(stderr), fileno(stdout));
+#endif
+
+            if (!this->m_pResponses)
+                throw std::runtime_error("Failed To Keep stdout For The Responses");
+
+            return;
+        }
+
+#ifdef _WIN32
+        throw std::runtime_error("--socket Isn't Supported On Windows, Send The Jobs Over stdin");
+#else
+        sockaddr_un address = {};
+        address.sun_family = AF_UNIX;
+        if (socketPath.size() >= sizeof(address.sun_path))
+            throw std::runtime_error("The Socket Path Is Too Long: " + socketPath);
+        std::memcpy(address.sun_path, socketPath.c_str(), socketPath.size() + 1u);
+
+        // A Socket Left Behind By A Previous Server Is Replaced, Any Other File Is Kept
+        struct stat fileStatus;
+        if (stat(socketPath.c_str(), &fileStatus) == 0 && S_ISSOCK(fileStatus.st_mode))
+            unlink(socketPath.c_str());
+
+        this->m_listenSocket = socket(AF_UNIX, SOCK_STREAM, 0);
+        if (this->m_listenSocket < 0 || bind(this->m_listenSocket, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) != 0 ||
+            listen(this->m_listenSocket, 8) != 0) {
+            const std::string error = std::strerror(errno);
+            if (this->m_listenSocket >= 0)
+                close(this->m_listenSocket);
+
+            throw std::runtime_error("Failed To Listen On " + socketPath + ": " + error);
+        }
+
+        // A Client Hanging Up Before Its Response Is Written Mustn't Kill The Server
+        signal(SIGPIPE, SIG_IGN);
+#endif
+    }
+
+    JobChannel(const JobChannel&)            = delete;
+    JobChannel& operator=(const JobChannel&) = delete;
+
+    ~JobChannel() {
+        if (this->m_pResponses)
+            std::fclose(this->m_pResponses);
+
+#ifndef _WIN32
+        if (this->m_clientSocket >= 0)
+            close(this->m_clientSocket);
+
+        if (this->m_listenSocket >= 0) {
+            close(this->m_listenSocket);
+            unlink(this->m_socketPath.c_str());
+        }
+#endif
+    }
+
+    // Waits For The Next Line (Or Client), False Once stdin Is Closed Or The Socket Fails
+    bool ReadLine(std::string& line) {
+        if (this->m_pResponses)
+            return static_cast<bool>(std::getline(std::cin, line));
+
+#ifndef _WIN32
+        for (;;) {
+            const size_t newline = this->m_received.find('\n');
+            if (newline != std::string::npos) {
+                line = this->m_received.substr(0u, newline);
+                this->m_received.erase(0u, newline + 1u);
+                return true;
+            }
+
+            if (this->m_clientSocket < 0) {
+                this->m_clientSocket = accept(this->m_listenSocket, nullptr, nullptr);
+                if (this->m_clientSocket < 0 && errno != EINTR)
+                    return false;
+
+                continue;
+            }
+
+            char buffer[4096];
+            const ssize_t receivedSize = recv(this->m_clientSocket, buffer, sizeof(buffer), 0);
+            if (receivedSize > 0) {
+                this->m_received.append(buffer, static_cast<size_t>(receivedSize));
+                continue;
+            }
+
+            if (receivedSize < 0 && errno == EINTR)
+                continue;
+
+            // The Client Hung Up, An Unterminated Last Line Goes With It
+            close(this->m_clientSocket);
+            this->m_clientSocket = -1;
+            this->m_received.clear();
+        }
+#else
+        return false;
+#endif
+    }
+
+    // Answers The Current Client, A Client That Already Hung Up Is Noticed By The Next Read
+    void WriteLine(const std::string& line) {
+        if (this->m_pResponses) {
+            std::fprintf(this->m_pResponses, "%s\n", line.c_str());
+            std::fflush(this->m_pResponses);
+            return;
+        }
+
+#ifndef _WIN32
+        const std::string message = line + '\n';
+        for (size_t sent = 0u; sent < message.size() && this->m_clientSocket >= 0; ) {
+            const ssize_t sentSize = send(this->m_clientSocket, message.data() + sent, message.size() - sent, 0);
+            if (sentSize < 0 && errno != EINTR)
+                break;
+
+            sent += static_cast<size_t>(std::max<ssize_t>(sentSize, 0));
+        }
+#endif
+    }
+}; // JobChannel
+
+// Parses A Flat JSON Object, Whose Members Are Strings, Numbers, Booleans Or null. Strings Are Unescaped, Other Values Kept As Written
+std::map<std::string, std::string> ParseJsonObject(const std::string& text) {
+    size_t i = 0u;
+
+    auto SkipWhitespace = [&]() {
+        while (i < text.size() && std::isspace(static_cast<unsigned char>(text[i])))
+            i++;
+    };
+
+    auto Expect = [&](const char c) {
+        SkipWhitespace();
+        if (i >= text.size() || text[i] != c)
+            throw std::runtime_error(std::string("Expected '") + c + "' At Offset " + std::to_string(i));
+        i++;
+    };
+
+    auto ParseString = [&]() {
+        Expect('"');
+
+        std::string result;
+        for (;;) {
+            if (i >= text.size())
+                throw std::runtime_error("Unterminated String");
+
+            const char c = text[i++];
+            if (c == '"')
+                return result;
+
+            if (c != '\\') {
+                result += c;
+                continue;
+            }
+
+            const char escaped = (i < text.size()) ? text[i++] : '\0';
+            switch (escaped) {
+            case '"': case '\\': case '/': result += escaped; break;
+            case 'b': result += '\b'; break;
+            case 'f': result += '\f'; break;
+            case 'n': result += '\n'; break;
+            case 'r': result += '\r'; break;
+            case 't': result += '\t'; break;
+            case 'u': {
+                // Encoded As UTF-8, Surrogate Pairs Aren't Supported
+                const std::string hex = text.substr(i, 4u);
+                char* pEnd = nullptr;
+                const unsigned long codePoint = std::strtoul(hex.c_str(), &pEnd, 16);
+                if (hex.size() != 4u || *pEnd != '\0' || (codePoint >= 0xD800u && codePoint <= 0xDFFFu))
+                    throw std::runtime_error("Unsupported \\u Escape At Offset " + std::to_string(i));
+                i += 4u;
+
+                if (codePoint < 0x80u) {
+                    result += static_cast<char>(codePoint);
+                } else if (codePoint < 0x800u) {
+                    result += static_cast<char>(0xC0u | (codePoint >> 6u));
+                    result += static_cast<char>(0x80u | (codePoint & 0x3Fu));
+                } else {
+                    result += static_cast<char>(0xE0u | (codePoint >> 12u));
+                    result += static_cast<char>(0x80u | ((codePoint >> 6u) & 0x3Fu));
+                    result += static_cast<char>(0x80u | (codePoint & 0x3Fu));
+                }
+                break;
+            }
+            default:
+                throw std::runtime_error("Invalid Escape At Offset " + std::to_string(i));
+            }
+        }
+    };
+
+    std::map<std::string, std::string> members;
+
+    Expect('{');
+    SkipWhitespace();
+    if (i < text.size() && text[i] == '}') {
+        i++;
+    } else {
+        for (bool bMore = true; bMore; ) {
+            const std::string name = ParseString();
+            Expect(':');
+            SkipWhitespace();
+
+            if (i < text.size() && text[i] == '"') {
+                members[name] = ParseString();
+            } else {
+                const size_t valueStart = i;
+                while (i < text.size() && text[i] != ',' && text[i] != '}' && !std::isspace(static_cast<unsigned char>(text[i])))
+                    i++;
+
+                const std::string value = text.substr(valueStart, i - valueStart);
+                if (value.empty() || value[0] == '{' || value[0] == '[')
+                    throw std::runtime_error("\"" + name + "\" Must Be A String, A Number, A Boolean Or null");
+
+                members[name] = value;
+            }
+
+            SkipWhitespace();
+            bMore = i < text.size() && text[i] == ',';
+            if (bMore)
+                i++;
+        }
+
+        Expect('}');
+    }
+
+    SkipWhitespace();
+    if (i != text.size())
+        throw std::runtime_error("Unexpected Characters After The Object At Offset " + std::to_string(i));
+
+    return members;
+}
+
+// Sets The Job Option A Member Of A Job Object Names (./PolarTracer serve's Jobs & bench suite's Cases), False For Other Names
+bool ApplyJobMember(CommandLineArguments& job, const std::string& name, const std::string& value) {
+    auto ParsePositive = [&]() {
+        char* pEnd = nullptr;
+        const unsigned long long parsed = std::strtoull(value.c_str(), &pEnd, 10);
+        if (value.empty() || *pEnd != '\0' || parsed == 0u || parsed > UINT32_MAX)
+            throw std::runtime_error("\"" + name + "\" Must Be A Positive Integer");
+
+        return static_cast<std::uint32_t>(parsed);
+    };
+
+    // The Option Parsers Fall Back To Their Default For Unknown Names, A Job Is Told Instead Of Getting Another Output
+    auto ParseName = [&](const std::initializer_list<const char*> names) -> const std::string& {
+        std::string accepted;
+        for (const char* pName : names) {
+            if (value == pName)
+                return value;
+
+            accepted += (accepted.empty() ? "" : ", ") + std::string(pName);
+        }
+
+        throw std::runtime_error("\"" + name + "\" Must Be One Of " + accepted);
+    };
+
+    if (name == "width")             job.surfaceWidth       = ParsePositive();
+    else if (name == "height")       job.surfaceHeight      = ParsePositive();
+    else if (name == "spp")          job.samplesPerPixel    = ParsePositive();
+    else if (name == "bounces")      job.maxBounces         = ParsePositive();
+    else if (name == "scene")        job.sceneFilename      = value;
+    else if (name == "output")       job.outputPrefix       = value;
+    else if (name == "format")       job.outputFormat       = ParseImageFormat(ParseName({ "png", "qoi", "pam" }));
+    else if (name == "tonemap")      job.toneMapping        = ParseToneMapping(ParseName({ "linear", "gamma", "srgb" }));
+    else if (name == "accumulation") job.accumulationFormat = ParseAccumulationFormat(ParseName({ "rgba32f", "rgba16f" }));
+    else if (name == "resolve")      job.gpuResolve         = ParseGpuResolve(ParseName({ "host", "rgba8", "rgb9e5" }));
+    else return false;
+
+    return true;
+}
+
+// ./PolarTracer serve: Creates The Devices Once, Then Renders Each Job Read From stdin (Or --socket) & Answers It With Its Timings
+// A Job Looks Like { "id": "preview-1", "width": 640, "height": 360, "spp": 64, "scene": "room.pscn", "output": "preview" }
+// Its Members Are Optional & Default To The Command Line's Options, "id" Is Echoed Back. { "command": "shutdown" } Stops The Server
+void RunServer(const CommandLineArguments& commandLineArguments) {
+    JobChannel channel(commandLineArguments.serverSocket);
+
+    // A Profile Report Covers One Run, Not A Server's Lifetime
+    Profiler profiler(false);
+    if (!commandLineArguments.profileFilename.empty())
+        std::printf("--profile Is Ignored By serve\n");
+
+    if (commandLineArguments.frameCount > 1u || !commandLineArguments.cameraPathFilename.empty() || !commandLineArguments.checkpointFilename.empty() ||
+        !commandLineArguments.exportSceneFilename.empty())
+        std::printf("serve Renders One Frame Per Job, --frames, --camera-path, --checkpoint & --export-scene Are Ignored\n");
+
+    std::optional<GpuContext> context;
+    if (commandLineArguments.backend != Backend::eCPU) {
+        try {
+            context.emplace(CreateGpuContext(commandLineArguments, profiler));
+        }
+        catch (const NoCompatibleDeviceError& err) {
+            if (commandLineArguments.backend == Backend::eGPU)
+                throw;
+
+            std::printf("%s, Falling Back To The CPU Backend\n", err.what());
+        }
+    }
+
+    std::printf("Serving Jobs On %s\n", commandLineArguments.serverSocket.empty() ? "stdin" : commandLineArguments.serverSocket.c_str());
+
+    // The Last Job's Scene Stays Loaded (& On The Devices) Until A Job Names Another File Or The File Changes
+    std::optional<Scene>            scene;
+    std::string                     sceneFilename;
+    std::filesystem::file_time_type sceneWriteTime;
+    bool                            bUploadScene = true;
+
+    std::uint64_t jobIndex = 0u;
+    for (std::string line; channel.ReadLine(line); ) {
+        if (!line.empty() && line.back() == '\r')
+            line.pop_back();
+        if (line.find_first_not_of(" \t") == std::string::npos)
+            continue;
+
+        const auto jobStart = std::chrono::steady_clock::now();
+
+        std::optional<std::string> id;
+        bool                       bShutdown = false;
+        std::string                response;
+
+        auto GetMilliseconds = [](const double seconds) {
+            char text[32] = { 0 };
+            std::snprintf(text, sizeof(text), "%.3f", seconds * 1e3);
+            return std::string(text);
+        };
+
+        try {
+            CommandLineArguments job = commandLineArguments;
+            job.frameCount = 1u;
+            job.cameraPathFilename.clear();
+            job.checkpointFilename.clear();
+            job.exportSceneFilename.clear();
+            job.profileFilename.clear();
+
+            const auto members = ParseJsonObject(line);
+            for (const auto& [name, value] : members) {
+                if (name == "id")           id = value;
+                else if (name == "command") bShutdown = (value == "shutdown");
+                else if (!ApplyJobMember(job, name, value))
+                    throw std::runtime_error("Unknown Job Member \"" + name + "\"");
+            }
+
+            if (members.count("command") && !bShutdown)
+                throw std::runtime_error("Unknown Command: " + members.at("command"));
+
+            if (bShutdown) {
+                response = "\"status\": \"ok\"";
+            } else {
+                if (job.surfaceWidth == 0u || job.surfaceHeight == 0u)
+                    throw std::runtime_error("The Job Needs A \"width\" & A \"height\" (Or serve's -w & -h)");
+
+                // The Timestamped Default Name Only Has A Resolution Of A Second, The Job's Index Keeps It Unique
+                if (job.outputPrefix.empty())
+                    job.outputPrefix = GenerateOutputFilename() + "-" + std::to_string(jobIndex);
+
+                // A Missing File Gets No Write Time & Fails To Load Below
+                std::error_code writeTimeError;
+                const std::filesystem::file_time_type writeTime = job.sceneFilename.empty() ?
+                    std::filesystem::file_time_type{} : std::filesystem::last_write_time(job.sceneFilename, writeTimeError);
+
+                const bool bReusedScene = scene && job.sceneFilename == sceneFilename && writeTime == sceneWriteTime;
+                double     sceneSeconds = 0.0;
+                if (!bReusedScene) {
+                    const auto sceneStart = std::chrono::steady_clock::now();
+
+                    scene.reset();
+                    scene.emplace(job.sceneFilename.empty() ? Scene::CreateDefault() : Scene::Load(job.sceneFilename));
+                    sceneFilename = job.sceneFilename;
+                    sceneWriteTime = writeTime;
+                    bUploadScene   = true;
+
+                    sceneSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - sceneStart).count();
+                }
+
+                const std::vector<Camera> cameras = { scene->GetCamera() };
+
+                JobTimings timings;
+                if (context) {
+                    Checkpointer       checkpointer(job, *scene, cameras.front()); // Disabled, Jobs Have No Checkpoint
+                    Profiler::Counters profileCounters;
+
+                    timings      = RenderGpuJob(*context, job, *scene, bUploadScene, cameras, checkpointer, profiler, profileCounters);
+                    bUploadScene = false;
+                } else {
+                    const auto renderStart = std::chrono::steady_clock::now();
+                    RunCpuBackend(job, *scene, cameras, profiler);
+                    timings.renderSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - renderStart).count();
+                }
+
+                timings.sceneSeconds = sceneSeconds;
+
+                response = "\"status\": \"ok\", \"output\": \"" + EscapeJSON(job.outputPrefix + GetImageFileExtension(job.outputFormat)) + "\"" +
+                    ", \"width\": " + std::to_string(job.surfaceWidth) + ", \"height\": " + std::to_string(job.surfaceHeight) +
+                    ", \"spp\": " + std::to_string(job.samplesPerPixel) + ", \"backend\": \"" + (context ? "gpu" : "cpu") + "\"" +
+                    ", \"timings\": { \"sceneMs\": " + GetMilliseconds(timings.sceneSeconds) + ", \"prepareMs\": " + GetMilliseconds(timings.prepareSeconds) +
+                    ", \"renderMs\": " + GetMilliseconds(timings.renderSeconds) + ", \"readbackBytes\": " + std::to_string(timings.readbackBytes) +
+                    ", \"totalMs\": " + GetMilliseconds(std::chrono::duration<double>(std::chrono::steady_clock::now() - jobStart).count()) + " }" +
+                    ", \"reused\": { \"scene\": " + (bReusedScene ? "true" : "false") + ", \"buffers\": " + (timings.bReusedBuffers ? "true" : "false") +
+                    ", \"pipelines\": " + (timings.bReusedPipelines ? "true" : "false") +
+                    ", \"descriptors\": " + (timings.bReusedDescriptors ? "true" : "false") + " }";
+            }
+        }
+        catch (const std::exception& err) {
+            std::printf("Job Failed: %s\n", err.what());
+
+            response = "\"status\": \"error\", \"error\": \"" + EscapeJSON(err.what()) + "\"" +
+                ", \"timings\": { \"totalMs\": " + GetMilliseconds(std::chrono::duration<double>(std::chrono::steady_clock::now() - jobStart).count()) + " }";
+        }
+
+        channel.WriteLine("{ \"id\": " + (id ? ("\"" + EscapeJSON(*id) + "\"") : std::string("null")) + ", " + response + " }");
+
+        jobIndex++;
+        if (bShutdown)
+            break;
+    }
+
+    if (context)
+        DestroyGpuContext(*context, profiler);
+}
+
+// The Process' Peak Resident Memory. Linux Resets It Before Each Of bench suite's Cases, Elsewhere It Covers The Run So Far
+void ResetPeakResidentMemory() noexcept {
+#ifdef __linux__
+    if (std::FILE* pFile = std::fopen("/proc/self/clear_refs", "w")) {
+        std::fputs("5", pFile);
+        std::fclose(pFile);
+    }
+#endif
+}
+
+std::uint64_t GetPeakResidentMemory() noexcept {
+#if defined(_WIN32)
+    PROCESS_MEMORY_COUNTERS counters = {};
+    return K32GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)) ? counters.PeakWorkingSetSize : 0u;
+#elif defined(__linux__)
+    std::ifstream status("/proc/self/status");
+    for (std::string line; std::getline(status, line); )
+        if (line.compare(0u, 6u, "VmHWM:") == 0)
+            return std::strtoull(line.c_str() + 6u, nullptr, 10) * 1024u; // In kB
+
+    return 0u;
+#else
+    struct rusage usage = {};
+    return (getrusage(RUSAGE_SELF, &usage) == 0) ? static_cast<std::uint64_t>(usage.ru_maxrss) : 0u; // In Bytes On macOS
+#endif
+}
+
+// ./PolarTracer bench suite [--cases <file>] [--references <dir>] [--output <dir>] [--report <file>] [--baseline <report>] ...
+// Renders Every Case (A Job Object Per Line, As serve Reads Them) End To End On A Context Of Its Own, Compares The Image With The
+// Case's Reference & Its Samples/s With The Baseline's & Writes A Report Of Both. Returns Whether No Case Failed: A Case Without
+// A Reference Doesn't Pass, But Is Only Reported, So That The Suite Runs Before Any Reference Was Recorded
+bool RunBenchmarkSuite(const CommandLineArguments& commandLineArguments) {
+    // Every Sample Is Taken & Nothing Depends On The Clock, So Each Case Renders The Same Image On Every Run
+    CommandLineArguments suiteArguments = commandLineArguments;
+    suiteArguments.frameCount        = 1u;
+    suiteArguments.timeBudget        = 0.f;
+    suiteArguments.adaptiveThreshold = 0.f;
+    suiteArguments.outputFormat      = ImageFormat::ePAM;
+    suiteArguments.cameraPathFilename.clear();
+    suiteArguments.checkpointFilename.clear();
+    suiteArguments.exportSceneFilename.clear();
+    suiteArguments.profileFilename.clear();
+
+    const std::filesystem::path casesDirectory  = std::filesystem::path(commandLineArguments.suiteCasesFilename).parent_path();
+    const std::filesystem::path outputDirectory = commandLineArguments.outputPrefix.empty() ? "bench-output" : commandLineArguments.outputPrefix;
+    const std::filesystem::path referenceDirectory = commandLineArguments.suiteReferenceDirectory;
+    std::filesystem::create_directories(outputDirectory);
+    if (commandLineArguments.bUpdateReferences)
+        std::filesystem::create_directories(referenceDirectory);
+
+    // The Baseline's Cases By Id, Only Compared When They Rendered The Same Job On The Same Device
+    std::map<std::string, std::map<std::string, std::string>> baseline;
+    if (!commandLineArguments.suiteBaselineFilename.empty()) {
+        std::ifstream baselineFile(commandLineArguments.suiteBaselineFilename);
+        if (!baselineFile.is_open())
+            throw std::runtime_error("Failed To Open Baseline " + commandLineArguments.suiteBaselineFilename);
+
+        for (std::string line; std::getline(baselineFile, line); ) {
+            if (line.find_first_not_of(" \t\r") == std::string::npos)
+                continue;
+
+            auto members = ParseJsonObject(line.substr(0u, line.find_last_not_of("\r") + 1u));
+            baseline[members["case"]] = std::move(members);
+        }
+    }
+
+    std::ifstream casesFile(commandLineArguments.suiteCasesFilename);
+    if (!casesFile.is_open())
+        throw std::runtime_error("Failed To Open Benchmark Cases " + commandLineArguments.suiteCasesFilename);
+
+    std::ofstream report;
+    if (!commandLineArguments.suiteReportFilename.empty()) {
+        report.open(commandLineArguments.suiteReportFilename, std::ios::trunc);
+        if (!report.is_open())
+            throw std::runtime_error("Failed To Open Report " + commandLineArguments.suiteReportFilename);
+    }
+
+    auto FormatNumber = [](const double value, const char* pFormat) {
+        char text[32] = { 0 };
+        std::snprintf(text, sizeof(text), pFormat, value);
+        return std::string(text);
+    };
+
+    std::vector<std::string> rows;
+    bool                     bPassed          = true;
+    std::uint32_t            noReferenceCount = 0u;
+
+    std::string line;
+    for (size_t lineNumber = 1u; std::getline(casesFile, line); lineNumber++) {
+        if (!line.empty() && line.back() == '\r')
+            line.pop_back();
+        if (line.find_first_not_of(" \t") == std::string::npos)
+            continue;
+
+        auto Fail = [&](const std::string& reason) {
+            return std::runtime_error(commandLineArguments.suiteCasesFilename + ":" + std::to_string(lineNumber) + ": " + reason);
+        };
+
+        CommandLineArguments job = suiteArguments;
+        std::string          id;
+        for (const auto& [name, value] : ParseJsonObject(line)) {
+            if (name == "id")
+                id = value;
+            else if (!ApplyJobMember(job, name, value))
+                throw Fail("Unknown Case Member \"" + name + "\"");
+        }
+
+        if (id.empty() || job.surfaceWidth == 0u || job.surfaceHeight == 0u)
+            throw Fail("A Case Needs An \"id\", A \"width\" & A \"height\"");
+
+        if (!job.sceneFilename.empty())
+            job.sceneFilename = (casesDirectory / job.sceneFilename).string();
+        job.outputPrefix = (outputDirectory / id).string();
+
+        std::printf("\nCase %s: %ux%u, %u SPP, %u Bounces\n", id.c_str(), job.surfaceWidth, job.surfaceHeight, job.samplesPerPixel, job.maxBounces);
+
+        ResetPeakResidentMemory();
+        const auto caseStart = std::chrono::steady_clock::now();
+
+        const Scene               scene   = job.sceneFilename.empty() ? Scene::CreateDefault() : Scene::Load(job.sceneFilename);
+        const std::vector<Camera> cameras = LoadCameraPath("", 1u, scene.GetCamera());
+
+        Profiler           profiler(false);
+        Profiler::Counters profileCounters;
+        std::string        deviceName = "CPU";
+        double             renderSeconds = 0.0;
+        std::uint64_t      peakDeviceBytes = 0u;
+
+        std::optional<GpuContext> context;
+        if (job.backend != Backend::eCPU) {
+            try {
+                context.emplace(CreateGpuContext(job, profiler));
+            }
+            catch (const NoCompatibleDeviceError& err) {
+                if (job.backend == Backend::eGPU)
+                    throw;
+
+                std::printf("%s, Falling Back To The CPU Backend\n", err.what());
+            }
+        }
+
+        if (context) {
+            Checkpointer     checkpointer(job, scene, cameras.front()); // Disabled
+            const JobTimings timings = RenderGpuJob(*context, job, scene, true, cameras, checkpointer, profiler, profileCounters);
+            renderSeconds = timings.renderSeconds;
+
+            deviceName.clear();
+            for (const std::unique_ptr<GpuDevice>& pDevice : context->devices) {
+                deviceName      += (deviceName.empty() ? "" : " + ") + pDevice->name;
+                peakDeviceBytes += pDevice->memoryArena->GetPeakDeviceLocalCommitted();
+            }
+
+            DestroyGpuContext(*context, profiler);
+        } else {
+            const auto renderStart = std::chrono::steady_clock::now();
+            RunCpuBackend(job, scene, cameras, profiler);
+            renderSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - renderStart).count();
+
+            profileCounters.samples = static_cast<std::uint64_t>(job.surfaceWidth) * job.surfaceHeight * job.samplesPerPixel;
+        }
+
+        const double        wallSeconds      = std::chrono::duration<double>(std::chrono::steady_clock::now() - caseStart).count();
+        const double        samplesPerSecond = (renderSeconds > 0.0) ? (profileCounters.samples / renderSeconds) : 0.0;
+        const std::uint64_t peakHostBytes    = GetPeakResidentMemory();
+
+        std::string status = "pass";
+        std::string psnrValue = "null", rmseValue = "null", baselineValue = "null";
+
+        { // Compare The Image With The Reference
+            const std::string imageFilename     = job.outputPrefix + GetImageFileExtension(ImageFormat::ePAM);
+            const std::string referenceFilename = (referenceDirectory / (id + GetImageFileExtension(ImageFormat::ePAM))).string();
+
+            if (commandLineArguments.bUpdateReferences) {
+                std::filesystem::copy_file(imageFilename, referenceFilename, std::filesystem::copy_options::overwrite_existing);
+                status = "updated";
+            } else if (!std::filesystem::exists(referenceFilename)) {
+                std::printf("No Reference Image %s, Record It With --update-references on\n", referenceFilename.c_str());
+                status = "no-reference";
+                noReferenceCount++;
+            } else {
+                std::uint32_t imageWidth = 0u, imageHeight = 0u, referenceWidth = 0u, referenceHeight = 0u;
+                const std::vector<Coloru8> image     = ReadPamImage(imageFilename, imageWidth, imageHeight);
+                const std::vector<Coloru8> reference = ReadPamImage(referenceFilename, referenceWidth, referenceHeight);
+
+                if (imageWidth != referenceWidth || imageHeight != referenceHeight) {
+                    std::printf("The Image Is %ux%u, Its Reference %ux%u\n", imageWidth, imageHeight, referenceWidth, referenceHeight);
+                    status = "failed";
+                } else {
+                    double squaredError = 0.0;
+                    for (size_t i = 0u; i < image.size(); i++) {
+                        const double dr = (image[i].r - reference[i].r) / 255.0;
+                        const double dg = (image[i].g - reference[i].g) / 255.0;
+                        const double db = (image[i].b - reference[i].b) / 255.0;
+                        squaredError += dr * dr + dg * dg + db * db;
+                    }
+
+                    // Identical Images Are Given 100 dB, Which JSON Can Hold Unlike Infinity
+                    const double rmse = std::sqrt(squaredError / (3.0 * image.size()));
+                    const double psnr = (rmse > 0.0) ? std::min(100.0, -20.0 * std::log10(rmse)) : 100.0;
+
+                    rmseValue = FormatNumber(rmse, "%.6f");
+                    psnrValue = FormatNumber(psnr, "%.2f");
+                    if (psnr < commandLineArguments.minPsnr)
+                        status = "failed";
+                }
+            }
+        }
+
+        { // Compare The Throughput With The Baseline
+            const auto it = baseline.find(id);
+            if (it != baseline.end()) {
+                std::map<std::string, std::string>& previous = it->second;
+
+                const bool bSameJob = previous["device"] == deviceName && previous["width"] == std::to_string(job.surfaceWidth) &&
+                    previous["height"] == std::to_string(job.surfaceHeight) && previous["spp"] == std::to_string(job.samplesPerPixel) &&
+                    previous["bounces"] == std::to_string(job.maxBounces);
+                const double baselineSamplesPerSecond = std::atof(previous["samplesPerSecond"].c_str());
+
+                if (!bSameJob) {
+                    std::printf("The Baseline Rendered %s Differently Or On Another Device, Not Compared\n", id.c_str());
+                } else if (baselineSamplesPerSecond > 0.0) {
+                    baselineValue = FormatNumber(baselineSamplesPerSecond, "%.0f");
+                    if (samplesPerSecond < baselineSamplesPerSecond * (1.0 - commandLineArguments.maxSlowdown) && (status == "pass" || status == "no-reference"))
+                        status = "slower";
+                }
+            }
+        }
+
+        bPassed = bPassed && (status == "pass" || status == "updated" || status == "no-reference");
+
+        if (report.is_open()) {
+            report << "{ \"case\": \"" << EscapeJSON(id) << "\", \"device\": \"" << EscapeJSON(deviceName) << "\""
+                   << ", \"width\": " << job.surfaceWidth << ", \"height\": " << job.surfaceHeight << ", \"spp\": " << job.samplesPerPixel
+                   << ", \"bounces\": " << job.maxBounces << ", \"wallMs\": " << FormatNumber(wallSeconds * 1e3, "%.3f")
+                   << ", \"renderMs\": " << FormatNumber(renderSeconds * 1e3, "%.3f") << ", \"samplesPerSecond\": " << FormatNumber(samplesPerSecond, "%.0f")
+                   << ", \"peakHostMiB\": " << FormatNumber(peakHostBytes / (1024.0 * 1024.0), "%.2f")
+                   << ", \"peakDeviceMiB\": " << FormatNumber(peakDeviceBytes / (1024.0 * 1024.0), "%.2f")
+                   << ", \"rmse\": " << rmseValue << ", \"psnr\": " << psnrValue << ", \"baselineSamplesPerSecond\": " << baselineValue
+                   << ", \"status\": \"" << status << "\" }\n";
+        }
+
+        const double speedup = (baselineValue != "null") ? (samplesPerSecond / std::atof(baselineValue.c_str()) - 1.0) * 100.0 : 0.0;
+
+        char row[256] = { 0 };
+        std::snprintf(row, sizeof(row), "%-26s  %10.1f  %12.0f  %9.1f  %9.1f  %8s  %9s  %s", id.c_str(), wallSeconds * 1e3, samplesPerSecond,
+            peakHostBytes / (1024.0 * 1024.0), peakDeviceBytes / (1024.0 * 1024.0), (psnrValue == "null") ? "-" : psnrValue.c_str(),
+            (baselineValue == "null") ? "-" : FormatNumber(speedup, "%+.1f%%").c_str(), status.c_str());
+        rows.push_back(row);
+    }
+
+    // Printed Once The Renders' Own Logging Is Done
+    std::printf("\n%-26s  %10s  %12s  %9s  %9s  %8s  %9s  %s\n", "Case", "Wall ms", "Samples/s", "Host MiB", "Dev MiB", "PSNR dB", "Baseline", "Status");
+    for (const std::string& row : rows)
+        std::printf("%s\n", row.c_str());
+
+    if (noReferenceCount > 0u)
+        std::printf("\n%u Of %zu Cases Have No Reference, Their Images Weren't Checked\n", noReferenceCount, rows.size());
+
+    if (report.is_open())
+        std::printf("\nReport Written To %s\n", commandLineArguments.suiteReportFilename.c_str());
+
+    return bPassed;
+}
+
+int main(int argc, char** argv) {
+    InitOSApis();
+
+    const auto commandLineArguments = ParseCommandLineArguments(argc, argv);
+
+    // ./PolarTracer merge Needs Neither A Scene Nor A Device
+    if (argc > 1 && std::strcmp(argv[1], "merge") == 0) {
+        Profiler profiler(!commandLineArguments.profileFilename.empty());
+
+        try {
+            RunMerge(commandLineArguments, profiler);
+        }
+        catch (const std::exception& err) {
+            std::printf("Fatal Error %s\n", err.what());
+        }
+
+        return 0;
+    }
+
+    // ./PolarTracer bench suite Loads Each Case's Scene & Devices Itself, Its Exit Code Tells CI Whether Any Case Failed
+    if (commandLineArguments.benchmark == "suite") {
+        try {
+            return RunBenchmarkSuite(commandLineArguments) ? 0 : 1;
+        }
+        catch (const std::exception& err) {
+            std::printf("Fatal Error %s\n", err.what());
+        }
+
+        return 1;
+    }
+
+    // ./PolarTracer serve Keeps The Devices Until stdin Closes Or A Shutdown Job Arrives
+    if (argc > 1 && std::strcmp(argv[1], "serve") == 0) {
+        try {
+            RunServer(commandLineArguments);
+        }
+        catch (const std::exception& err) {
+            std::printf("Fatal Error %s\n", err.what());
+        }
+
+        return 0;
+    }
+
+    std::printf("Width: %u, Height: %u, SPP: %u, Bounces: %u\n", commandLineArguments.surfaceWidth, commandLineArguments.surfaceHeight,
+        commandLineArguments.samplesPerPixel, commandLineArguments.maxBounces);
+
+    Profiler profiler(!commandLineArguments.profileFilename.empty());
+
+    // Declared Outside The try Block So That The CPU Fallback Can Reuse Them
+    std::optional<Scene> scene;
+    std::vector<Camera>  cameras;
+
+    try {
+        { // Load The Scene
+            const ProfileScope profileScope(profiler, "Load Scene");
+            const auto         loadStart = std::chrono::steady_clock::now();
+
+            scene.emplace(commandLineArguments.sceneFilename.empty() ? Scene::CreateDefault() : Scene::Load(commandLineArguments.sceneFilename));
+
+            std::printf("Scene Loaded In %.3fms: %u Materials, %u Spheres, %u Planes, %u Triangles (BVH: %u Nodes Built In %.3fms), %u Lights\n",
+                std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - loadStart).count(),
+                scene->GetSectionCount(eSceneSectionMaterials), scene->GetSectionCount(eSceneSectionSpheres), scene->GetSectionCount(eSceneSectionPlanes),
+                scene->GetSectionCount(eSceneSectionTriangles), scene->GetSectionCount(eSceneSectionBvhNodes), scene->GetBvhBuildMilliseconds(),
+                scene->GetSectionCount(eSceneSectionLights));
+
+            if (!commandLineArguments.exportSceneFilename.empty())
+                scene->Save(commandLineArguments.exportSceneFilename);
+        }
+
+        cameras = LoadCameraPath(commandLineArguments.cameraPathFilename, commandLineArguments.frameCount, scene->GetCamera());
+
+        if (commandLineArguments.benchmark == "sampling") {
+            RunSamplingBenchmark(commandLineArguments, *scene, cameras.front());
+            return 0;
+        } else if (commandLineArguments.benchmark == "readback") {
+            RunReadbackBenchmark(commandLineArguments, *scene, cameras, profiler);
+            return 0;
+        } else if (!commandLineArguments.benchmark.empty()) {
+            throw std::runtime_error("Unknown Benchmark: " + commandLineArguments.benchmark);
+        }
+
+        if (commandLineArguments.backend == Backend::eCPU) {
+            RunCpuBackend(commandLineArguments, *scene, cameras, profiler);
+            return 0;
+        }
+
+        // Loaded Before Any Device Is Created, A Checkpoint That Can't Be Resumed Fails Early
+        Checkpointer checkpointer(commandLineArguments, *scene, cameras.front());
+
+        GpuContext context = CreateGpuContext(commandLineArguments, profiler);
+        const std::vector<std::unique_ptr<GpuDevice>>& devices = context.devices;
+
+        Profiler::Counters profileCounters;
+        RenderGpuJob(context, commandLineArguments, *scene, true, cameras, checkpointer, profiler, profileCounters);
+
+        if (profiler.IsEnabled()) { // Read The Ray Counters
+            for (const std::unique_ptr<GpuDevice>& pDevice : devices) {
+                pDevice->rayStatsBuffer->InvalidateMappedMemory();
+                const RayStats* pRayStats = reinterpret_cast<const RayStats*>(pDevice->rayStatsBuffer->MapMemory());
+                profileCounters.rays += (static_cast<std::uint64_t>(pRayStats->rayCountHi) << 32u) | pRayStats->rayCountLo;
+            }
+        }
+
+        // The Report Names Every Device That Rendered
+        std::string deviceName;
+        for (const std::unique_ptr<GpuDevice>& pDevice : devices)
+            deviceName += (deviceName.empty() ? "" : " + ") + pDevice->name;
+
+        DestroyGpuContext(context, profiler);
+
+        if (profiler.IsEnabled()) { // Write The Profile Report
+            profiler.WriteReport(commandLineArguments.profileFilename,
+                (commandLineArguments.gpuKernel == GpuKernel::eWavefront) ? (deviceName + " (Wavefront)") : deviceName, profileCounters);
+
+            std::printf("Profile Written To %s (%.3f Mrays/s)\n", commandLineArguments.profileFilename.c_str(),
+                (profileCounters.renderSeconds > 0.0) ? (profileCounters.rays / profileCounters.renderSeconds / 1e6) : 0.0);
+        }
+    }
+    catch (const NoCompatibleDeviceError& err) {
+        if (commandLineArguments.backend == Backend::eGPU) {
+            std::printf("Fatal Error %s\n", err.what());
+        } else {
+            std::printf("%s, Falling Back To The CPU Backend\n", err.what());
+
+            try {
+                RunCpuBackend(commandLineArguments, *scene, cameras, profiler);
+            }
+            catch (std::runtime_error re) {
+                std::printf("Fatal Error %s\n", re.what());
+            }
         }
     }
     catch (vk::SystemError err) {
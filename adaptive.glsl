@@ -0,0 +1,45 @@
+#version 440
+
+#include "common.glsl"
+
+// Dispatched Over The Whole Tile Before Each Adaptive Pass, One Thread Per Pixel
+layout (local_size_x_id = 0, local_size_y_id = 0, local_size_z = 1) in;
+
+// A Pixel Has Converged Once The Standard Error Of Its Mean Luminance Is Below ADAPTIVE_THRESHOLD Of That Mean
+bool HasConverged(const uint pixelIndex) {
+  const float sampleCount = LoadAccumulation(pixelIndex).a;
+  if (sampleCount < float(ADAPTIVE_MIN_SAMPLES))
+    return false;
+
+  const vec2  moments       = pixelMoments[pixelIndex];
+  const float variance      = moments.y / (sampleCount - 1.f);
+  const float standardError = sqrt(variance / sampleCount);
+
+  return standardError <= ADAPTIVE_THRESHOLD * max(moments.x, ADAPTIVE_BLACK_LEVEL);
+}
+
+// Appends The Tile's Unconverged Pixels To Its List (Whose Header The Host Resets To Zero)
+void main() {
+  if (gl_GlobalInvocationID.x >= passConstants.tileExtent.x || gl_GlobalInvocationID.y >= passConstants.tileExtent.y)
+    return;
+
+  const uvec2 pixel      = passConstants.tileOffset + gl_GlobalInvocationID.xy;
+  const uint  pixelIndex = GetBufferIndex(pixel);
+  if (HasConverged(pixelIndex))
+    return;
+
+  const uint listIndex = atomicAdd(pixelListHeaders[passConstants.pixelList].count, 1u);
+  pixelLists[passConstants.pixelListOffset + listIndex] = pixelIndex;
+
+  // Both Group Counts Grow With The List, So Each Always Covers Exactly Its Threads
+  if (listIndex % (WORKGROUP_SIZE * WORKGROUP_SIZE) == 0u)
+    atomicAdd(pixelListHeaders[passConstants.pixelList].groupCountX, 1u);
+
+  const uint firstPath       = listIndex * passConstants.sampleCount;
+  const uint pathGroupsBegun = (firstPath + passConstants.sampleCount + WAVEFRONT_WORKGROUP_SIZE - 1u) / WAVEFRONT_WORKGROUP_SIZE -
+                               (firstPath + WAVEFRONT_WORKGROUP_SIZE - 1u) / WAVEFRONT_WORKGROUP_SIZE;
+
+  atomicAdd(pixelListHeaders[passConstants.pixelList].pathCount, passConstants.sampleCount);
+  if (pathGroupsBegun > 0u)
+    atomicAdd(pixelListHeaders[passConstants.pixelList].pathGroupCountX, pathGroupsBegun);
+}
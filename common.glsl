@@ -0,0 +1,725 @@
+// Shared By shader.glsl (The Single-Kernel Path Tracer) & The wavefront_*.glsl Kernels
+// Included With #include "common.glsl", Which The Host Expands Before Compiling (glslc Handles It Natively)
+
+// Specialization Constants (Filled In By The Host From The Command Line, The Values Below Are Defaults)
+layout (constant_id = 0) const uint WORKGROUP_SIZE = 32;   // The Number Of Threads Per Workgroup Side (NVIDIA: 32, AMD: 64)
+layout (constant_id = 1) const uint WIDTH          = 960;  // The Target Surface's Width  In Pixels
+layout (constant_id = 2) const uint HEIGHT         = 540;  // The Target Surface's Height In Pixels
+layout (constant_id = 3) const uint MAX_ITERATIONS = 10;   // The Maximum Number Of Iterations For Each Sample
+layout (constant_id = 4) const bool PROFILE        = false; // Count The Rays Cast Into RayStats (--profile)
+layout (constant_id = 5) const uint WAVEFRONT_WORKGROUP_SIZE = 64; // The Number Of Threads Per Workgroup Of The 1D Wavefront Kernels
+layout (constant_id = 6) const uint SAMPLE_SEQUENCE = 0;           // SAMPLE_SEQUENCE_PCG Or SAMPLE_SEQUENCE_SOBOL (--sampler)
+layout (constant_id = 7) const bool  ADAPTIVE             = false; // Keep Per-Pixel Moments & Skip Converged Pixels (--adaptive)
+layout (constant_id = 8) const float ADAPTIVE_THRESHOLD   = 0.01f; // The Relative Standard Error Below Which A Pixel Has Converged
+layout (constant_id = 9) const uint  ADAPTIVE_MIN_SAMPLES = 16;    // Pixels Are Never Considered Converged Before (--min-spp)
+layout (constant_id = 10) const bool AOV                  = false; // Accumulate The First Hit's Albedo, Depth & Normal (--denoise, --aov)
+layout (constant_id = 11) const bool OUT_OF_CORE          = false; // The Buffers Only Hold The Tile Being Rendered (--out-of-core)
+layout (constant_id = 12) const bool ACCUMULATION_HALF    = false; // The Accumulation Holds Half Means & 16-Bit Counts (--accumulation rgba16f)
+layout (constant_id = 13) const uint RESOLVE              = 0;     // RESOLVE_HOST, RESOLVE_RGBA8 Or RESOLVE_RGB9E5 (--resolve)
+layout (constant_id = 14) const uint TONE_MAPPING         = 0;     // TONE_MAPPING_* Applied By resolve.glsl With RESOLVE_RGBA8 (--tonemap)
+
+// Raw constant #defines
+#define FLT_MAX (3.402823466e+38) // Highest 32-bit Floating Point Number Possible
+#define EPSILON (0.001f)          // A Very Small Value
+#define M_PI    (3.1415926535897) // π
+#define PI_INV     (1.f / M_PI)
+#define TWO_PI_INV (1.f / (2.f * M_PI))
+#define NO_LIGHT   (~0u)              // The lightIndex Of Primitives That Don't Emit
+#define SAMPLE_SEQUENCE_PCG   (0u)
+#define SAMPLE_SEQUENCE_SOBOL (1u)
+#define LOW_DISCREPANCY_DIMENSION_GROUPS (7u) // The Camera & The Light And Direction Samples Of The First Three Bounces
+#define LIGHT_SPHERE   (0u)
+#define LIGHT_TRIANGLE (1u)
+#define NO_PIXEL_LIST  (~0u)              // The pixelList Of Passes That Cover Their Whole Tile
+#define ADAPTIVE_BLACK_LEVEL (1.f / 256.f) // Errors Are Relative To At Least This Luminance, So Dark Pixels Converge Too
+#define RESOLVE_HOST   (0u)
+#define RESOLVE_RGBA8  (1u)
+#define RESOLVE_RGB9E5 (2u)
+#define TONE_MAPPING_LINEAR (0u)
+#define TONE_MAPPING_GAMMA  (1u)
+#define TONE_MAPPING_SRGB   (2u)
+#define MAX_HALF           (65504.f) // The Largest Finite Half
+#define MAX_HALF_SAMPLES   (65535u)  // The Largest Sample Count Of A Half Accumulation
+
+// Shader Inputs
+layout (std140, binding = 0) buffer buf { vec4 pixelBuffer[]; }; // .rgb: Accumulated Color, .a: Accumulated Sample Count
+layout (std430, binding = 0) buffer HalfPixelBuffer { uvec2 halfPixelBuffer[]; }; // The Same Buffer When ACCUMULATION_HALF: .x: Mean rg, .y: Mean b | Sample Count << 16
+layout (std430, binding = 1) buffer RayStats { uint rayCountLo; uint rayCountHi; } rayStats; // 64-bit Ray Counter, Only Written When PROFILE
+
+// Set By The Host For Every Submit (Progressive Rendering)
+layout (push_constant) uniform PassConstants {
+  uvec2 tileOffset;   // The Top-Left Pixel Of The Tile Being Rendered
+  uvec2 tileExtent;   // The Size Of The Tile Being Rendered In Pixels
+  uint  sampleOffset; // The Index Of The First Sample Taken In This Pass
+  uint  sampleCount;  // The Number Of Samples Per Pixel Taken In This Pass
+  uint  frameIndex;   // The Index Of The Frame In A Batch / Animation
+  uint  bounceIndex;  // The Bounce Being Extended & Shaded (Wavefront Kernels Only)
+  uint  pixelList;       // The Tile's PixelListHeader When Only Its Unconverged Pixels Are Traced, NO_PIXEL_LIST Otherwise
+  uint  pixelListOffset; // Where The Tile's Pixels Start In pixelLists
+  vec4  cameraPosition;
+  vec4  cameraTarget;
+} passConstants;
+
+// A Pixel's Entry In The Accumulation, Moments & AOV Buffers, Which Hold The Whole Frame Or, OUT_OF_CORE, The Tile Alone
+uint GetBufferIndex(const uvec2 pixel) {
+  if (OUT_OF_CORE)
+    return (pixel.y - passConstants.tileOffset.y) * passConstants.tileExtent.x + (pixel.x - passConstants.tileOffset.x);
+
+  return WIDTH * pixel.y + pixel.x;
+}
+
+uvec2 GetBufferPixel(const uint bufferIndex) {
+  if (OUT_OF_CORE)
+    return passConstants.tileOffset + uvec2(bufferIndex % passConstants.tileExtent.x, bufferIndex / passConstants.tileExtent.x);
+
+  return uvec2(bufferIndex % WIDTH, bufferIndex / WIDTH);
+}
+
+// Adaptive Sampling (Only Bound To Real Buffers When ADAPTIVE)
+// Mirrored By PixelListHeader On The Host: Two VkDispatchIndirectCommands, Over The Listed Pixels & Over Their Paths
+struct PixelListHeader {
+  uint groupCountX, groupCountY, groupCountZ; // WORKGROUP_SIZE² Threads Per Group, One Per Pixel
+  uint count;
+  uint pathGroupCountX, pathGroupCountY, pathGroupCountZ; // WAVEFRONT_WORKGROUP_SIZE Threads Per Group, One Per (Pixel, Sample)
+  uint pathCount;
+};
+
+layout (std430, binding = 8)  buffer PixelMomentsBuffer     { vec2 pixelMoments[]; };           // Welford's Running Mean & M2 Of Each Pixel's Sample Luminance
+layout (std430, binding = 9)  buffer PixelListHeaderBuffer  { PixelListHeader pixelListHeaders[]; }; // One Per Tile, Read By The Host
+layout (std430, binding = 10) buffer PixelListBuffer        { uint pixelLists[]; };             // Buffer Indices, The Tiles' Lists Back To Back
+
+// The Number Of Pixels The Pass Traces In The Tile
+uint GetPassPixelCount() {
+  return (passConstants.pixelList == NO_PIXEL_LIST) ? (passConstants.tileExtent.x * passConstants.tileExtent.y) : pixelListHeaders[passConstants.pixelList].count;
+}
+
+uvec2 GetPassPixel(const uint passPixel) {
+  if (passConstants.pixelList == NO_PIXEL_LIST)
+    return passConstants.tileOffset + uvec2(passPixel % passConstants.tileExtent.x, passPixel / passConstants.tileExtent.x);
+
+  return GetBufferPixel(pixelLists[passConstants.pixelListOffset + passPixel]);
+}
+
+// For Kernels Laid Out Like shader.glsl: Dispatched Over The Tile, Or Indirectly Over The Pixel List With Linear Workgroups
+bool GetInvocationPassPixel(out uint passPixel) {
+  if (passConstants.pixelList == NO_PIXEL_LIST) {
+    passPixel = gl_GlobalInvocationID.y * passConstants.tileExtent.x + gl_GlobalInvocationID.x;
+    return gl_GlobalInvocationID.x < passConstants.tileExtent.x && gl_GlobalInvocationID.y < passConstants.tileExtent.y;
+  }
+
+  passPixel = gl_WorkGroupID.x * (gl_WorkGroupSize.x * gl_WorkGroupSize.y) + gl_LocalInvocationIndex;
+  return passPixel < GetPassPixelCount();
+}
+
+// First-Hit AOVs, Accumulated Like pixelBuffer: Albedo & Depth, Then The Normal (Only Bound To A Real Buffer When AOV)
+layout (std430, binding = 11) buffer AovBuffer { vec4 aovs[]; }; // Two Per Pixel
+
+// One Word Per Pixel Packed By resolve.glsl, Read Back Instead Of The Accumulation (Only Bound To A Real Buffer Unless RESOLVE_HOST)
+layout (std430, binding = 12) buffer ResolvedBuffer { uint resolvedPixels[]; };
+
+float Luminance(const vec3 color) {
+  return dot(color, vec3(0.2126f, 0.7152f, 0.0722f));
+}
+
+// Welford's Update With The Pass' 'sampleCount'-th Sample
+void AddToMoments(inout vec2 moments, const uint sampleCount, const float value) {
+  const float delta = value - moments.x;
+  moments.x += delta / float(sampleCount);
+  moments.y += delta * (value - moments.x);
+}
+
+// A Pixel's Accumulated Color & Sample Count, Whichever Way It Is Stored
+vec4 LoadAccumulation(const uint pixelIndex) {
+  if (ACCUMULATION_HALF) {
+    const uvec2 packed      = halfPixelBuffer[pixelIndex];
+    const float sampleCount = float(packed.y >> 16u);
+    return vec4(vec3(unpackHalf2x16(packed.x), unpackHalf2x16(packed.y).x) * sampleCount, sampleCount);
+  }
+
+  return pixelBuffer[pixelIndex];
+}
+
+// Half Accumulations Keep The Mean Rather Than The Sum, Which Would Overflow (& Lose Precision) As Samples Add Up
+void StoreAccumulation(const uint pixelIndex, const vec4 accumulation) {
+  if (ACCUMULATION_HALF) {
+    const vec3 mean = (accumulation.a > 0.f) ? min(accumulation.rgb / accumulation.a, vec3(MAX_HALF)) : vec3(0.f);
+    halfPixelBuffer[pixelIndex] = uvec2(packHalf2x16(mean.rg), (packHalf2x16(vec2(mean.b, 0.f)) & 0xFFFFu) | (min(uint(accumulation.a), MAX_HALF_SAMPLES) << 16u));
+    return;
+  }
+
+  pixelBuffer[pixelIndex] = accumulation;
+}
+
+// Adds A Pass' Samples To The Pixel, Merging Their Moments Into The Pixel's (Chan et al.) When ADAPTIVE
+void AccumulatePass(const uvec2 pixel, const vec3 passColor, const vec2 passMoments, const vec4 passAlbedoDepth, const vec4 passNormal) {
+  const uint pixelIndex = GetBufferIndex(pixel);
+
+  if (AOV) {
+    aovs[2u * pixelIndex]      += passAlbedoDepth;
+    aovs[2u * pixelIndex + 1u] += passNormal;
+  }
+
+  const vec4 accumulation = LoadAccumulation(pixelIndex);
+
+  if (ADAPTIVE) {
+    const float previousCount = accumulation.a;
+    const float passCount     = float(passConstants.sampleCount);
+    const float totalCount    = previousCount + passCount;
+
+    const vec2  moments = pixelMoments[pixelIndex];
+    const float delta   = passMoments.x - moments.x;
+    pixelMoments[pixelIndex] = vec2(moments.x + delta * (passCount / totalCount), moments.y + passMoments.y + delta * delta * (previousCount * passCount / totalCount));
+  }
+
+  StoreAccumulation(pixelIndex, accumulation + vec4(passColor, float(passConstants.sampleCount)));
+}
+
+// Misc Constants
+const float cameraFOV = M_PI / 5;
+const float cameraProjectH = tan(cameraFOV);
+
+// Random Number Generation
+// Every Sample Draws From Its Own Counter-Based Stream, Seeded By A Hash Of Its Pixel, Frame & Sample Index,
+// So That Pixels Are Decorrelated & Any Kernel Can Trace Any Sample In Any Order
+uint samplerSeed  = 0; // Hash Of The Pixel & Frame, Also Scrambles The Low-Discrepancy Sequence
+uint samplerIndex = 0; // The Sample's Index In Its Pixel's Sequence
+uint rngState     = 0; // PCG State
+
+// The PCG-RXS-M-XS Output Permutation
+uint PcgPermute(const uint state) {
+  const uint word = ((state >> ((state >> 28u) + 4u)) ^ state) * 277803737u;
+  return (word >> 22u) ^ word;
+}
+
+uint Hash(const uint value) {
+  return PcgPermute(value * 747796405u + 2891336453u);
+}
+
+uint HashCombine(const uint seed, const uint value) {
+  return seed ^ (value + (seed << 6u) + (seed >> 2u));
+}
+
+// The Top 24 Bits, So That The Result Is Exactly Representable & Below 1
+float ToUnitFloat(const uint bits) {
+  return float(bits >> 8u) * (1.f / 16777216.f);
+}
+
+float RandomFloat() {
+  rngState = rngState * 747796405u + 2891336453u;
+  return ToUnitFloat(PcgPermute(rngState));
+}
+
+void BeginSample(const uvec2 pixel, const uint sampleIndex) {
+  samplerSeed  = Hash((pixel.y * WIDTH + pixel.x) ^ Hash(passConstants.frameIndex));
+  samplerIndex = sampleIndex;
+  rngState     = HashCombine(samplerSeed, Hash(sampleIndex));
+}
+
+// The Direction Numbers Of Sobol's First Three Dimensions (Joe & Kuo)
+const uint[96] sobolDirections = {
+  0x80000000u, 0x40000000u, 0x20000000u, 0x10000000u, 0x08000000u, 0x04000000u, 0x02000000u, 0x01000000u, 0x00800000u, 0x00400000u, 0x00200000u, 0x00100000u, 0x00080000u, 0x00040000u, 0x00020000u, 0x00010000u, 0x00008000u, 0x00004000u, 0x00002000u, 0x00001000u, 0x00000800u, 0x00000400u, 0x00000200u, 0x00000100u, 0x00000080u, 0x00000040u, 0x00000020u, 0x00000010u, 0x00000008u, 0x00000004u, 0x00000002u, 0x00000001u,
+  0x80000000u, 0xc0000000u, 0xa0000000u, 0xf0000000u, 0x88000000u, 0xcc000000u, 0xaa000000u, 0xff000000u, 0x80800000u, 0xc0c00000u, 0xa0a00000u, 0xf0f00000u, 0x88880000u, 0xcccc0000u, 0xaaaa0000u, 0xffff0000u, 0x80008000u, 0xc000c000u, 0xa000a000u, 0xf000f000u, 0x88008800u, 0xcc00cc00u, 0xaa00aa00u, 0xff00ff00u, 0x80808080u, 0xc0c0c0c0u, 0xa0a0a0a0u, 0xf0f0f0f0u, 0x88888888u, 0xccccccccu, 0xaaaaaaaau, 0xffffffffu,
+  0x80000000u, 0xc0000000u, 0x60000000u, 0x90000000u, 0xe8000000u, 0x5c000000u, 0x8e000000u, 0xc5000000u, 0x68800000u, 0x9cc00000u, 0xee600000u, 0x55900000u, 0x80680000u, 0xc09c0000u, 0x60ee0000u, 0x90550000u, 0xe8808000u, 0x5cc0c000u, 0x8e606000u, 0xc5909000u, 0x6868e800u, 0x9c9c5c00u, 0xeeee8e00u, 0x5555c500u, 0x8000e880u, 0xc0005cc0u, 0x60008e60u, 0x9000c590u, 0xe8006868u, 0x5c009c9cu, 0x8e00eeeeu, 0xc5005555u
+};
+
+uint Sobol(uint index, const uint dimension) {
+  uint result = 0u;
+  for (uint bit = 0u; index != 0u; bit++, index >>= 1u) {
+    if ((index & 1u) != 0u)
+      result ^= sobolDirections[dimension * 32u + bit];
+  }
+
+  return result;
+}
+
+// Owen Scrambling As A Hash Of The Reversed Bits (Laine & Karras, Constants From Burley 2020)
+uint NestedUniformScramble(uint x, const uint seed) {
+  x  = bitfieldReverse(x);
+  x += seed;
+  x ^= x * 0x6c50b47cu;
+  x ^= x * 0xb82f1e52u;
+  x ^= x * 0xc7afe638u;
+  x ^= x * 0x8d22f6e6u;
+  return bitfieldReverse(x);
+}
+
+// Up To Three Dimensions Of The Sample: The Camera Is Group 0, Bounce N Samples A Light With Group 2N + 1 & Its Next Direction With Group 2N + 2
+// With SAMPLE_SEQUENCE_SOBOL The First Groups Come From A Shuffled, Owen-Scrambled Sobol Sequence (Burley 2020),
+// Each Group Padded With Its Own Seed. Every Other Dimension Comes From The Sample's PCG Stream
+vec3 SampleDimensions(const uint dimensionGroup, const uint dimensionCount) {
+  vec3 result = vec3(0.f);
+
+  if (SAMPLE_SEQUENCE == SAMPLE_SEQUENCE_SOBOL && dimensionGroup < LOW_DISCREPANCY_DIMENSION_GROUPS) {
+    const uint groupSeed = HashCombine(samplerSeed, dimensionGroup);
+    const uint index     = NestedUniformScramble(samplerIndex, groupSeed); // Stays Stratified Over Power-Of-Two Prefixes
+
+    for (uint dimension = 0u; dimension < dimensionCount; dimension++)
+      result[dimension] = ToUnitFloat(NestedUniformScramble(Sobol(index, dimension), HashCombine(groupSeed, dimension + 1u)));
+  } else {
+    for (uint dimension = 0u; dimension < dimensionCount; dimension++)
+      result[dimension] = RandomFloat();
+  }
+
+  return result;
+}
+
+// Custom Datatypes
+struct Material {
+  vec4 diffuseColor;
+  vec4 emittance;
+};
+
+// The Scene Layouts Are Mirrored By SceneSphere & ScenePlane On The Host (std430, 32 Bytes Each)
+struct Sphere {
+  vec3  center;
+  float radius;
+  uint  materialIndex;
+  uint  lightIndex;    // Into lights[], NO_LIGHT Unless The Material Emits
+};
+
+struct Plane {
+  vec3 point;         // any point on the plane
+  uint materialIndex; // the plane's material
+  vec3 normal;        // the plane's normalized normal
+};
+
+// SceneTriangle (48 Bytes) & SceneBvhNode (32 Bytes) On The Host
+struct Triangle {
+  vec3 v0;            // the first vertex
+  uint materialIndex; // the triangle's material
+  vec3 edge1;         // v1 - v0
+  uint lightIndex;    // Into lights[], NO_LIGHT Unless The Material Emits
+  vec3 edge2;         // v2 - v0
+};
+
+// A Threaded BVH In Preorder: The Left Child Follows Its Parent, 'index' Is Where To Go Once A Subtree Is Done
+struct BvhNode {
+  vec3 boundsMin;
+  uint primitiveCount; // > 0: A Leaf Whose Triangles Start At 'index', 0: An Interior Node Whose Escape Is 'index'
+  vec3 boundsMax;
+  uint index;
+};
+
+// An Emissive Sphere Or Triangle, Mirrored By SceneLight On The Host (16 Bytes)
+struct Light {
+  uint  primitiveType;  // LIGHT_SPHERE Or LIGHT_TRIANGLE
+  uint  primitiveIndex;
+  float cdf;            // The Sum Of The Probabilities Up To & Including This Light (The Last One Is 1)
+  float probability;    // The Chance Of Being Picked For A Shadow Ray, Proportional To The Light's Power
+};
+
+struct Ray {
+  vec3 origin;    // the ray's origin
+  vec3 direction; // the ray's normalized direction
+};
+
+struct Intersection {
+  vec3  inDirection;   // the direction of the incoming ray
+  float t;             // distance from the ray's origin to intersection point
+  vec3  location;      // location of intersection
+  vec3  normal;        // the normal at the intersection
+  uint  materialIndex; // the material that the intersected object is made of (Fetched From materials[] When Shading)
+  uint  lightIndex;    // the intersected object's entry in lights[], NO_LIGHT If It Can't Be Sampled
+};
+
+#define NULL_RAY          (Ray(vec3(0.0f), vec3(0.0f)))
+#define NULL_INTERSECTION (Intersection(vec3(0.f), FLT_MAX, vec3(0.f), vec3(0.f), 0u, NO_LIGHT))
+
+// The Scene, Loaded At Runtime: Each Section Of The Scene Buffer Starts With Its Element Count
+layout (std430, binding = 2) readonly buffer MaterialBuffer { uint materialCount; Material materials[]; };
+layout (std430, binding = 3) readonly buffer SphereBuffer   { uint sphereCount;   Sphere   spheres[];   };
+layout (std430, binding = 4) readonly buffer PlaneBuffer    { uint planeCount;    Plane    planes[];    };
+layout (std430, binding = 5) readonly buffer TriangleBuffer { uint triangleCount; Triangle triangles[]; };
+layout (std430, binding = 6) readonly buffer BvhBuffer      { uint bvhNodeCount;  BvhNode  bvhNodes[];  };
+layout (std430, binding = 7) readonly buffer LightBuffer    { uint lightCount;    Light    lights[];    };
+
+Intersection Intersects(const Ray ray, const Sphere sphere) {
+  const vec3  L   = sphere.center - ray.origin;
+  const float tca = dot(L, ray.direction);
+  const float d2  = dot(L, L) - tca * tca;
+  const float radius2 = sphere.radius * sphere.radius;
+
+  if (d2 > radius2)
+    return NULL_INTERSECTION;
+  
+  const float thc = sqrt(radius2 - d2);
+  float t0 = tca - thc;
+  float t1 = tca + thc;
+
+  if (t0 > t1) {
+    const float tmp = t0;
+    t0 = t1;
+    t1 = tmp;
+  }
+
+  if (t0 < EPSILON) {
+    t0 = t1;
+
+    if (t0 < 0)
+      return NULL_INTERSECTION;
+  }
+
+  Intersection intersection;
+  intersection.t             = t0;
+  intersection.location      = ray.origin + t0 * ray.direction;
+  intersection.normal        = normalize(intersection.location - sphere.center);
+  intersection.materialIndex = sphere.materialIndex;
+  intersection.lightIndex    = sphere.lightIndex;
+  intersection.inDirection   = ray.direction;
+
+  return intersection;
+}
+
+Intersection Intersects(const Ray ray, const Plane plane) {
+  const float denominator = dot(plane.normal, ray.direction);
+  if (abs(denominator) < 1e-6f) // Parallel To The Plane
+    return NULL_INTERSECTION;
+
+  const float t = dot(plane.point - ray.origin, plane.normal) / denominator;
+  if (t < EPSILON)
+    return NULL_INTERSECTION;
+
+  Intersection intersection;
+  intersection.t             = t;
+  intersection.location      = ray.origin + t * ray.direction;
+  intersection.normal        = (denominator < 0.f) ? plane.normal : -plane.normal; // Facing The Incoming Ray
+  intersection.materialIndex = plane.materialIndex;
+  intersection.lightIndex    = NO_LIGHT; // Infinite, So Only Found By Following The BSDF
+  intersection.inDirection   = ray.direction;
+
+  return intersection;
+}
+
+// Slab Test Against [0, tMax)
+bool IntersectsBounds(const Ray ray, const vec3 inverseDirection, const BvhNode node, const float tMax) {
+  const vec3 t0 = (node.boundsMin - ray.origin) * inverseDirection;
+  const vec3 t1 = (node.boundsMax - ray.origin) * inverseDirection;
+  const vec3 slabNear = min(t0, t1);
+  const vec3 slabFar  = max(t0, t1);
+
+  const float tNear = max(max(slabNear.x, slabNear.y), max(slabNear.z, 0.f));
+  const float tFar  = min(min(slabFar.x, slabFar.y), min(slabFar.z, tMax));
+
+  return tNear <= tFar;
+}
+
+// Moller-Trumbore, Returns FLT_MAX On A Miss
+float Intersects(const Ray ray, const Triangle triangle) {
+  const vec3  p   = cross(ray.direction, triangle.edge2);
+  const float det = dot(triangle.edge1, p);
+  if (det == 0.f)
+    return FLT_MAX;
+
+  const float inverseDet = 1.f / det;
+  const vec3  tv = ray.origin - triangle.v0;
+  const float u  = dot(tv, p) * inverseDet;
+
+  const vec3  q = cross(tv, triangle.edge1);
+  const float v = dot(ray.direction, q) * inverseDet;
+  const float t = dot(triangle.edge2, q) * inverseDet;
+
+  if (!(u >= 0.f && v >= 0.f && u + v <= 1.f && t >= EPSILON))
+    return FLT_MAX;
+
+  return t;
+}
+
+uint rayCount = 0; // Rays Cast By This Invocation, Only Counted When PROFILE
+
+Intersection FindClosestIntersection(const Ray inRay) {
+  if (PROFILE)
+    rayCount++;
+
+  Intersection closestIntersection = NULL_INTERSECTION;
+  for (uint i = 0; i < sphereCount; i++) {
+    Intersection currentIntersection = Intersects(inRay, spheres[i]);
+    if (currentIntersection.t < closestIntersection.t)
+      closestIntersection = currentIntersection;
+  }
+
+  for (uint i = 0; i < planeCount; i++) {
+    Intersection currentIntersection = Intersects(inRay, planes[i]);
+    if (currentIntersection.t < closestIntersection.t)
+      closestIntersection = currentIntersection;
+  }
+
+  // Stackless Walk Of The BVH, Only The Closest Triangle Is Turned Into An Intersection
+  const vec3 inverseDirection = 1.f / inRay.direction;
+  float tTriangle     = closestIntersection.t;
+  uint  triangleIndex = ~0u;
+  for (uint nodeIndex = 0; nodeIndex < bvhNodeCount; ) {
+    const BvhNode node = bvhNodes[nodeIndex];
+
+    if (!IntersectsBounds(inRay, inverseDirection, node, tTriangle)) {
+      nodeIndex = (node.primitiveCount > 0) ? nodeIndex + 1 : node.index;
+      continue;
+    }
+
+    for (uint i = node.index; i < node.index + node.primitiveCount; i++) {
+      const float t = Intersects(inRay, triangles[i]);
+      if (t < tTriangle) {
+        tTriangle     = t;
+        triangleIndex = i;
+      }
+    }
+
+    nodeIndex++;
+  }
+
+  if (triangleIndex != ~0u) {
+    const Triangle triangle = triangles[triangleIndex];
+    const vec3     normal   = normalize(cross(triangle.edge1, triangle.edge2));
+
+    closestIntersection.t             = tTriangle;
+    closestIntersection.location      = inRay.origin + tTriangle * inRay.direction;
+    closestIntersection.normal        = (dot(normal, inRay.direction) > 0.f) ? -normal : normal; // Facing The Incoming Ray
+    closestIntersection.materialIndex = triangle.materialIndex;
+    closestIntersection.lightIndex    = triangle.lightIndex;
+    closestIntersection.inDirection   = inRay.direction;
+  }
+
+  return closestIntersection;
+}
+
+// Shadow Rays: Whether Anything Is Hit In [EPSILON, tMax), Stopping At The First Hit
+bool IsOccluded(const Ray inRay, const float tMax) {
+  if (PROFILE)
+    rayCount++;
+
+  for (uint i = 0; i < sphereCount; i++)
+    if (Intersects(inRay, spheres[i]).t < tMax)
+      return true;
+
+  for (uint i = 0; i < planeCount; i++)
+    if (Intersects(inRay, planes[i]).t < tMax)
+      return true;
+
+  const vec3 inverseDirection = 1.f / inRay.direction;
+  for (uint nodeIndex = 0; nodeIndex < bvhNodeCount; ) {
+    const BvhNode node = bvhNodes[nodeIndex];
+
+    if (!IntersectsBounds(inRay, inverseDirection, node, tMax)) {
+      nodeIndex = (node.primitiveCount > 0) ? nodeIndex + 1 : node.index;
+      continue;
+    }
+
+    for (uint i = node.index; i < node.index + node.primitiveCount; i++)
+      if (Intersects(inRay, triangles[i]) < tMax)
+        return true;
+
+    nodeIndex++;
+  }
+
+  return false;
+}
+
+// An Orthonormal Basis Around The Unit Vector 'n' (Duff et al. 2017)
+void BuildBasis(const vec3 n, out vec3 tangent, out vec3 bitangent) {
+  const float s = (n.z >= 0.f) ? 1.f : -1.f;
+  const float a = -1.f / (s + n.z);
+  const float b = n.x * n.y * a;
+
+  tangent   = vec3(1.f + s * n.x * n.x * a, s * b, -s * n.x);
+  bitangent = vec3(b, s + n.y * n.y * a, -n.y);
+}
+
+// Lambertian Scattering: Directions Around 'normal' With pdf = cos / PI, Which Cancels The BRDF's cos / PI
+vec3 SampleCosineHemisphere(const vec3 normal, const vec2 u, out float pdf) {
+  vec3 tangent, bitangent;
+  BuildBasis(normal, tangent, bitangent);
+
+  const float r        = sqrt(u.x);
+  const float phi      = 2.f * M_PI * u.y;
+  const float cosTheta = sqrt(max(1.f - u.x, 0.f));
+
+  pdf = cosTheta * PI_INV;
+  return normalize(r * cos(phi) * tangent + r * sin(phi) * bitangent + cosTheta * normal);
+}
+
+// Binary Search Of The Lights' CDF
+uint SelectLight(const float u) {
+  uint first = 0, last = lightCount - 1;
+  while (first < last) {
+    const uint middle = (first + last) / 2;
+    if (u < lights[middle].cdf)
+      last = middle;
+    else
+      first = middle + 1;
+  }
+
+  return first;
+}
+
+// The Solid Angle Pdf Of Sampling A Direction Towards 'sphere' From 'origin' (Uniform Over Its Cone), 0 From Inside
+float SphereSolidAnglePdf(const Sphere sphere, const vec3 origin) {
+  const vec3  toCenter  = sphere.center - origin;
+  const float distance2 = dot(toCenter, toCenter);
+  const float radius2   = sphere.radius * sphere.radius;
+  if (distance2 <= radius2)
+    return 0.f;
+
+  const float sin2ThetaMax = radius2 / distance2;
+  const float cosThetaMax  = sqrt(max(1.f - sin2ThetaMax, 0.f));
+
+  return 1.f / (2.f * M_PI * (sin2ThetaMax / (1.f + cosThetaMax))); // 1 - cos, Without Cancellation For Small Lights
+}
+
+// Samples A Point On A Light As Seen From 'origin', Returns False When The Light Can't Be Seen From There
+bool SampleLight(const Light light, const vec3 origin, const vec2 u, out vec3 direction, out float distance, out float pdf) {
+  if (light.primitiveType == LIGHT_SPHERE) {
+    const Sphere sphere = spheres[light.primitiveIndex];
+
+    pdf = SphereSolidAnglePdf(sphere, origin);
+    if (pdf == 0.f)
+      return false;
+
+    // Uniform In The Cone Of Directions The Sphere Subtends
+    const vec3  toCenter       = sphere.center - origin;
+    const float distance2      = dot(toCenter, toCenter);
+    const float centerDistance = sqrt(distance2);
+    const float radius2        = sphere.radius * sphere.radius;
+
+    const float sin2ThetaMax = radius2 / distance2;
+    const float cosTheta     = 1.f - u.x * (sin2ThetaMax / (1.f + sqrt(max(1.f - sin2ThetaMax, 0.f))));
+    const float sinTheta     = sqrt(max(1.f - cosTheta * cosTheta, 0.f));
+    const float phi          = 2.f * M_PI * u.y;
+
+    vec3 tangent, bitangent;
+    const vec3 axis = toCenter / centerDistance;
+    BuildBasis(axis, tangent, bitangent);
+
+    direction = normalize(sinTheta * cos(phi) * tangent + sinTheta * sin(phi) * bitangent + cosTheta * axis);
+
+    const float tca = centerDistance * cosTheta;
+    distance = tca - sqrt(max(radius2 - (distance2 - tca * tca), 0.f));
+  } else {
+    const Triangle triangle = triangles[light.primitiveIndex];
+
+    // Uniform Over The Triangle's Area
+    const float su    = sqrt(u.x);
+    const vec3  point = triangle.v0 + triangle.edge1 * (su * (1.f - u.y)) + triangle.edge2 * (su * u.y);
+
+    const vec3  normal    = cross(triangle.edge1, triangle.edge2);
+    const float area      = 0.5f * length(normal);
+    const vec3  toLight   = point - origin;
+    const float distance2 = dot(toLight, toLight);
+
+    distance  = sqrt(distance2);
+    direction = toLight / distance;
+
+    const float cosLight = abs(dot(normal, direction)) / (2.f * area);
+    if (!(cosLight > 0.f))
+      return false;
+
+    pdf = distance2 / (area * cosLight);
+  }
+
+  pdf *= light.probability;
+  return true;
+}
+
+// The Pdf Of SampleLight Picking The Point A Ray From 'origin' Hit
+float LightPdf(const Intersection intersection, const vec3 origin) {
+  const Light light = lights[intersection.lightIndex];
+
+  if (light.primitiveType == LIGHT_SPHERE)
+    return light.probability * SphereSolidAnglePdf(spheres[light.primitiveIndex], origin);
+
+  const Triangle triangle = triangles[light.primitiveIndex];
+  const float    area     = 0.5f * length(cross(triangle.edge1, triangle.edge2));
+  const float    cosLight = abs(dot(intersection.normal, intersection.inDirection));
+
+  return light.probability * intersection.t * intersection.t / (area * cosLight);
+}
+
+// Written As A Ratio So That Huge Pdfs (Grazing Or Distant Lights) Don't Overflow
+float PowerHeuristic(const float pdf, const float otherPdf) {
+  const float ratio = otherPdf / pdf;
+  return 1.f / (1.f + ratio * ratio);
+}
+
+// Adds The Light 'ray' Gathers At 'intersection' To 'radiance' & Scatters It, Returns False When The Path Ends
+// Light Reaches Each Vertex Both Through A Shadow Ray (Next-Event Estimation) & Through The Next Bounce Hitting An Emitter,
+// The Two Are Combined With The Power Heuristic (Multiple Importance Sampling)
+// 'bsdfPdf' Is The Pdf Of The Direction Of 'ray', 0 For Camera Rays
+bool ShadeIntersection(const Intersection intersection, const uint bounceIndex, inout Ray ray, inout vec3 throughput, inout vec3 radiance, inout float bsdfPdf) {
+  const Material material = materials[intersection.materialIndex];
+
+  // Emission, Weighted Against The Shadow Ray The Previous Vertex Cast
+  vec3 emittance = material.emittance.rgb;
+  if (bsdfPdf > 0.f && intersection.lightIndex != NO_LIGHT && emittance != vec3(0.f))
+    emittance *= PowerHeuristic(bsdfPdf, LightPdf(intersection, ray.origin));
+
+  radiance += throughput * emittance;
+
+  const vec3 albedo = material.diffuseColor.rgb;
+  if (bounceIndex + 1 == MAX_ITERATIONS || albedo == vec3(0.f))
+    return false;
+
+  const vec3 origin = intersection.location + intersection.normal * EPSILON;
+
+  // Next-Event Estimation
+  const vec3 lightSample = SampleDimensions(1u + 2u * bounceIndex, 3u);
+  if (lightCount > 0) {
+    const Light light = lights[SelectLight(lightSample.x)];
+
+    vec3  direction;
+    float distance, lightPdf;
+    if (SampleLight(light, origin, lightSample.yz, direction, distance, lightPdf)) {
+      const float cosSurface = dot(intersection.normal, direction);
+
+      if (cosSurface > 0.f && !IsOccluded(Ray(origin, direction), distance - EPSILON)) {
+        const vec3  lightEmittance = materials[(light.primitiveType == LIGHT_SPHERE) ? spheres[light.primitiveIndex].materialIndex : triangles[light.primitiveIndex].materialIndex].emittance.rgb;
+        const float weight         = PowerHeuristic(lightPdf, cosSurface * PI_INV);
+
+        radiance += throughput * albedo * PI_INV * lightEmittance * (cosSurface * weight / lightPdf);
+      }
+    }
+  }
+
+  // Continue The Path
+  ray.origin    = origin;
+  ray.direction = SampleCosineHemisphere(intersection.normal, SampleDimensions(2u + 2u * bounceIndex, 2u).xy, bsdfPdf);
+  throughput   *= albedo;
+
+  return true;
+}
+
+// Adds The AOVs Of A Camera Ray's Hit (Misses Add Nothing)
+void AddFirstHitAovs(const Intersection intersection, inout vec4 albedoDepth, inout vec4 normal) {
+  albedoDepth += vec4(materials[intersection.materialIndex].diffuseColor.rgb, intersection.t);
+  normal      += vec4(intersection.normal, 0.f);
+}
+
+Ray GenerateCameraRay(const uvec2 pixel) {
+  const uint pixelX = pixel.x;
+  const uint pixelY = pixel.y;
+
+  // Not A Global Constant: Float Conversions Of Specialization Constants Aren't Constant Expressions
+  const float cameraProjectW = cameraProjectH * float(WIDTH) / float(HEIGHT);
+
+  // Camera Basis, The Default Camera At The Origin Looking Down +Z Yields The Identity
+  const vec3 forward = normalize(passConstants.cameraTarget.xyz - passConstants.cameraPosition.xyz);
+  const vec3 right   = normalize(cross(vec3(0.f, 1.f, 0.f), forward));
+  const vec3 up      = cross(forward, right);
+
+  const vec2 jitter = SampleDimensions(0u, 2u).xy;
+
+  const vec3 cameraSpaceDirection = vec3(
+    (2.0f *  ((pixelX + jitter.x) / float(WIDTH))  - 1.0f) * cameraProjectW,
+    (-2.0f * ((pixelY + jitter.y) / float(HEIGHT)) + 1.0f) * cameraProjectH,
+    1.0f);
+
+  Ray ray;
+  ray.origin    = passConstants.cameraPosition.xyz;
+  ray.direction = normalize(cameraSpaceDirection.x * right + cameraSpaceDirection.y * up + cameraSpaceDirection.z * forward);
+
+  return ray;
+}
+
+// Adds This Invocation's Rays To The 64-bit Counter
+void FlushRayCount() {
+  const uint previousCount = atomicAdd(rayStats.rayCountLo, rayCount);
+  if (previousCount + rayCount < previousCount) // Carry Into The High Word
+    atomicAdd(rayStats.rayCountHi, 1u);
+}
@@ -0,0 +1,52 @@
+#version 440
+
+#include "common.glsl"
+
+// Dispatched Over A Tile After Its Final Pass, One Thread Per Pixel: Packs The Pixel For The Readback, Which Then
+// Moves A Word Per Pixel Instead Of The Accumulation
+layout (local_size_x_id = 0, local_size_y_id = 0, local_size_z = 1) in;
+
+// Mirrors The Host's ToneMappingLUT: The Value Is Quantized To 12 Bits Before The Transfer Function (Linear Goes Straight To 8 Bits)
+uint ToneMap(const float value) {
+  if (TONE_MAPPING == TONE_MAPPING_LINEAR)
+    return uint(roundEven(clamp(value, 0.f, 1.f) * 255.f));
+
+  const float x = roundEven(clamp(value, 0.f, 1.f) * 4095.f) / 4095.f;
+  const float y = (TONE_MAPPING == TONE_MAPPING_GAMMA) ? pow(x, 1.f / 2.2f) : ((x <= 0.0031308f) ? (12.92f * x) : (1.055f * pow(x, 1.f / 2.4f) - 0.055f));
+
+  return uint(y * 255.f + 0.5f);
+}
+
+// Three 9-Bit Mantissas Sharing A 5-Bit Exponent Biased By 15 (EXT_texture_shared_exponent's Encoding)
+uint PackRGB9E5(const vec3 color) {
+  const float MAX_RGB9E5 = 65408.f; // (511 / 512) * 2^15
+
+  const vec3  clamped    = clamp(color, vec3(0.f), vec3(MAX_RGB9E5));
+  const float maxChannel = max(clamped.r, max(clamped.g, clamped.b));
+
+  int   exponent = max(-16, int(floor(log2(max(maxChannel, 1e-20f))))) + 16;
+  float scale    = exp2(float(exponent - 15 - 9));
+
+  // Rounding The Largest Channel Up May Need One More Bit
+  if (uint(floor(maxChannel / scale + 0.5f)) == 512u) {
+    exponent++;
+    scale *= 2.f;
+  }
+
+  const uvec3 mantissas = uvec3(floor(clamped / scale + 0.5f));
+  return mantissas.r | (mantissas.g << 9u) | (mantissas.b << 18u) | (uint(exponent) << 27u);
+}
+
+void main() {
+  if (gl_GlobalInvocationID.x >= passConstants.tileExtent.x || gl_GlobalInvocationID.y >= passConstants.tileExtent.y)
+    return;
+
+  const uint pixelIndex   = GetBufferIndex(passConstants.tileOffset + gl_GlobalInvocationID.xy);
+  const vec4 accumulation = LoadAccumulation(pixelIndex);
+  const vec3 mean         = (accumulation.a > 0.f) ? (accumulation.rgb / accumulation.a) : vec3(0.f);
+
+  if (RESOLVE == RESOLVE_RGB9E5)
+    resolvedPixels[pixelIndex] = PackRGB9E5(mean);
+  else // Opaque RGBA8, The Host's Coloru8
+    resolvedPixels[pixelIndex] = ToneMap(mean.r) | (ToneMap(mean.g) << 8u) | (ToneMap(mean.b) << 16u) | (255u << 24u);
+}
@@ -0,0 +1,52 @@
+// Shared By The wavefront_*.glsl Kernels, Which Trace One Bounce Of Every Live Path At A Time:
+//   Generate   -> Camera Rays For Every (Pixel, Sample) Of The Tile (Or Of Its Pixel List), Written To Queue 0
+//   Extend     -> The Closest Hit Of Every Path In The Input Queue
+//   Shade      -> Scatters Or Terminates Every Path, Terminated Paths Write Their Sample's Radiance
+//   Compact    -> Appends The Surviving Paths To The Output Queue
+//   Accumulate -> Sums The Tile's Sample Radiance Into The Accumulation Buffer
+// Extend, Shade & Compact Are Dispatched Indirectly From The Input Queue's Header, So Each Bounce Only Launches Live Paths
+
+#include "common.glsl"
+
+// Mirrored By WavefrontPath On The Host (80 Bytes)
+struct PathState {
+  vec3  origin;
+  uint  sampleSlot;   // Where The Path Writes Its Radiance Once It Terminates
+  vec3  direction;
+  uint  rngState;     // The Sampler's State (See BeginSample), Carried From Kernel To Kernel
+  vec3  throughput;
+  float bsdfPdf;      // The Pdf Of 'direction', 0 For Camera Rays (See ShadeIntersection)
+  vec3  radiance;
+  uint  bActive;      // Cleared By Shade When The Path Terminates
+  uint  samplerSeed;
+  uint  samplerIndex;
+};
+
+// Mirrored By WavefrontHit On The Host (32 Bytes), The Location Is Recomputed From The Path's Ray
+struct Hit {
+  vec3  normal;
+  float t; // FLT_MAX On A Miss
+  uint  materialIndex;
+  uint  lightIndex;
+};
+
+// Mirrored By WavefrontQueue On The Host: A VkDispatchIndirectCommand Followed By The Queue's Length
+// Compact Grows 'groupCountX' Whenever It Starts A New Workgroup's Worth Of Paths, So It Always Equals ceil(count / WAVEFRONT_WORKGROUP_SIZE)
+struct Queue {
+  uint groupCountX, groupCountY, groupCountZ;
+  uint count;
+};
+
+layout (std430, set = 1, binding = 0) buffer PathBuffer           { PathState paths[]; };       // Two Queues Of GetPathCapacity() Paths, Ping-Ponged Every Bounce
+layout (std430, set = 1, binding = 1) buffer HitBuffer            { Hit hits[]; };              // Indexed Like The Input Queue
+layout (std430, set = 1, binding = 2) buffer QueueBuffer          { Queue queues[2]; };
+layout (std430, set = 1, binding = 3) buffer SampleRadianceBuffer { vec4 sampleRadiance[]; };   // Sample-Major: sampleIndex * GetPassPixelCount() + passPixel
+layout (std430, set = 1, binding = 4) buffer SampleAovBuffer      { vec4 sampleAovs[]; };       // Two Per Sample Slot, Written By Shade At Bounce 0 When AOV
+
+uint GetPathCapacity() {
+  return uint(sampleRadiance.length());
+}
+
+uint GetInputQueue() {
+  return passConstants.bounceIndex % 2u;
+}
@@ -0,0 +1,34 @@
+#version 440
+
+#include "wavefront.glsl"
+
+// Dispatched Like shader.glsl, One Thread Per Pixel
+layout (local_size_x_id = 0, local_size_y_id = 0, local_size_z = 1) in;
+
+void main() {
+  uint passPixel;
+  if (!GetInvocationPassPixel(passPixel))
+    return;
+
+  const uint passPixelCount = GetPassPixelCount();
+
+  // Summed In Sample Order, As shader.glsl Does
+  vec3 passColor   = vec3(0.f);
+  vec2 passMoments = vec2(0.f);
+  vec4 passAlbedoDepth = vec4(0.f), passNormal = vec4(0.f);
+  for (uint sampleIndex = 0; sampleIndex < passConstants.sampleCount; sampleIndex++) {
+    const vec3 radiance = sampleRadiance[sampleIndex * passPixelCount + passPixel].rgb;
+    passColor += radiance;
+
+    if (ADAPTIVE)
+      AddToMoments(passMoments, sampleIndex + 1u, Luminance(radiance));
+
+    if (AOV) {
+      const uint sampleSlot = sampleIndex * passPixelCount + passPixel;
+      passAlbedoDepth += sampleAovs[2u * sampleSlot];
+      passNormal      += sampleAovs[2u * sampleSlot + 1u];
+    }
+  }
+
+  AccumulatePass(GetPassPixel(passPixel), passColor, passMoments, passAlbedoDepth, passNormal);
+}
@@ -0,0 +1,24 @@
+#version 440
+
+#include "wavefront.glsl"
+
+layout (local_size_x_id = 5, local_size_y = 1, local_size_z = 1) in;
+
+// Appends The Live Paths Of The Input Queue To The Output Queue (Reset To Zero By The Host)
+void main() {
+  const uint inputQueue = GetInputQueue();
+  const uint queueIndex = gl_GlobalInvocationID.x;
+  if (queueIndex >= queues[inputQueue].count)
+    return;
+
+  const PathState path = paths[inputQueue * GetPathCapacity() + queueIndex];
+  if (path.bActive == 0u)
+    return;
+
+  const uint outputQueue = 1u - inputQueue;
+  const uint outputIndex = atomicAdd(queues[outputQueue].count, 1u);
+  if (outputIndex % WAVEFRONT_WORKGROUP_SIZE == 0u)
+    atomicAdd(queues[outputQueue].groupCountX, 1u);
+
+  paths[outputQueue * GetPathCapacity() + outputIndex] = path;
+}
@@ -0,0 +1,21 @@
+#version 440
+
+#include "wavefront.glsl"
+
+layout (local_size_x_id = 5, local_size_y = 1, local_size_z = 1) in;
+
+void main() {
+  const uint inputQueue = GetInputQueue();
+  const uint queueIndex = gl_GlobalInvocationID.x;
+  if (queueIndex >= queues[inputQueue].count)
+    return;
+
+  const PathState path = paths[inputQueue * GetPathCapacity() + queueIndex];
+
+  const Intersection intersection = FindClosestIntersection(Ray(path.origin, path.direction));
+
+  hits[queueIndex] = Hit(intersection.normal, intersection.t, intersection.materialIndex, intersection.lightIndex);
+
+  if (PROFILE)
+    FlushRayCount();
+}
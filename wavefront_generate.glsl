@@ -0,0 +1,23 @@
+#version 440
+
+#include "wavefront.glsl"
+
+layout (local_size_x_id = 5, local_size_y = 1, local_size_z = 1) in;
+
+// One Thread Per (Pixel, Sample) Of The Tile, Or Of Its Pixel List
+void main() {
+  const uint pathIndex      = gl_GlobalInvocationID.x;
+  const uint passPixelCount = GetPassPixelCount();
+  if (pathIndex >= passPixelCount * passConstants.sampleCount)
+    return;
+
+  const uint  sampleIndex = pathIndex / passPixelCount;
+  const uvec2 pixel       = GetPassPixel(pathIndex % passPixelCount);
+
+  // Seeded Like shader.glsl, So Both Kernels Trace The Same Paths
+  BeginSample(pixel, passConstants.sampleOffset + sampleIndex);
+
+  const Ray ray = GenerateCameraRay(pixel);
+
+  paths[pathIndex] = PathState(ray.origin, pathIndex, ray.direction, rngState, vec3(1.f), 0.f, vec3(0.f), 1u, samplerSeed, samplerIndex);
+}
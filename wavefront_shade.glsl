@@ -0,0 +1,53 @@
+#version 440
+
+#include "wavefront.glsl"
+
+layout (local_size_x_id = 5, local_size_y = 1, local_size_z = 1) in;
+
+void main() {
+  const uint inputQueue = GetInputQueue();
+  const uint queueIndex = gl_GlobalInvocationID.x;
+  if (queueIndex >= queues[inputQueue].count)
+    return;
+
+  const uint pathIndex = inputQueue * GetPathCapacity() + queueIndex;
+  PathState  path      = paths[pathIndex];
+  const Hit  hit       = hits[queueIndex];
+
+  bool bAlive = false;
+  vec4 albedoDepth = vec4(0.f), normal = vec4(0.f); // The Sample's AOVs, Given By The Camera Ray's Hit
+  if (hit.t != FLT_MAX) {
+    samplerSeed  = path.samplerSeed;
+    samplerIndex = path.samplerIndex;
+    rngState     = path.rngState;
+
+    Ray ray = Ray(path.origin, path.direction);
+    const Intersection intersection = Intersection(ray.direction, hit.t, ray.origin + hit.t * ray.direction, hit.normal, hit.materialIndex, hit.lightIndex);
+
+    if (AOV && passConstants.bounceIndex == 0u)
+      AddFirstHitAovs(intersection, albedoDepth, normal);
+
+    // The Same Shading As TracePath In shader.glsl
+    bAlive = ShadeIntersection(intersection, passConstants.bounceIndex, ray, path.throughput, path.radiance, path.bsdfPdf);
+
+    path.origin    = ray.origin;
+    path.direction = ray.direction;
+    path.rngState  = rngState;
+  }
+
+  // Every Path Is Still In The Queue At Bounce 0, Including Those That Missed
+  if (AOV && passConstants.bounceIndex == 0u) {
+    sampleAovs[2u * path.sampleSlot]      = albedoDepth;
+    sampleAovs[2u * path.sampleSlot + 1u] = normal;
+  }
+
+  if (!bAlive) {
+    sampleRadiance[path.sampleSlot] = vec4(path.radiance, 0.f);
+    path.bActive = 0u;
+  }
+
+  if (PROFILE)
+    FlushRayCount(); // Shadow Rays
+
+  paths[pathIndex] = path;
+}